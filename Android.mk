@@ -6,6 +6,10 @@ LOCAL_MODULE := zmath
 LOCAL_CPPFLAGS := -std=c++11
 LOCAL_SRC_FILES := zmath/zmath.cpp
 
+ifeq ($(TARGET_ARCH_ABI),armeabi-v7a)
+  LOCAL_ARM_NEON := true
+endif
+
 LOCAL_EXPORT_C_INCLUDES := $(LOCAL_PATH)
 
 include $(BUILD_STATIC_LIBRARY)
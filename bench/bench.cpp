@@ -0,0 +1,949 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "zmath/zmath.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Minimal Google Benchmark-style harness: every case is calibrated until it
+// runs for at least --min_time seconds, then reported as ns/op and ops/s.
+//
+//   zmath_bench [--filter=<substring>] [--min_time=<seconds>] [--json[=<file>]]
+
+namespace {
+
+struct bench_case {
+    std::string name;
+    std::function<void(size_t)> run;
+};
+
+struct bench_result {
+    std::string name;
+    size_t iterations;
+    double ns_per_op;
+};
+
+std::vector<bench_case>& registry() {
+    static std::vector<bench_case> cases;
+    return cases;
+}
+
+void add(const std::string& name, std::function<void(size_t)> run) {
+    registry().push_back(bench_case{name, run});
+}
+
+// Keeps the optimizer from discarding a computed value
+template<class V>
+inline void keep(const V& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static volatile char sink;
+    sink = *reinterpret_cast<const volatile char*>(&value);
+#endif
+}
+
+const size_t N = 256; // inputs per data set, small enough to stay in L1
+
+std::mt19937 rng(42);
+
+template<class T>
+T rnd(T min = -1, T max = 1) {
+    return std::uniform_real_distribution<T>(min, max)(rng);
+}
+
+template<class T>
+struct data_t {
+    std::vector<mat4x4_t<T>> mats;
+    std::vector<mat3x3_t<T>> rots;
+    std::vector<vec2_t<T>> vec2s;
+    std::vector<vec3_t<T>> vec3s;
+    std::vector<vec4_t<T>> vec4s;
+    std::vector<quat_t<T>> quats;
+    std::vector<plane_t<T>> planes;
+    std::vector<ray_t<T>> rays;
+
+    data_t() {
+        for (size_t i = 0; i < N; ++i) {
+            auto axis = normalize(vec3_t<T>(rnd<T>(), rnd<T>(), rnd<T>()));
+            auto q = quat_t<T>::rotation_axis(axis, rnd<T>(-3, 3));
+            mats.push_back(mat4x4_t<T>(q, vec3_t<T>(rnd<T>(), rnd<T>(), rnd<T>())) * mat4x4_t<T>::scale(rnd<T>(1, 2)));
+            rots.push_back(mat3x3_t<T>(q));
+            vec2s.push_back(vec2_t<T>(rnd<T>(), rnd<T>()));
+            vec3s.push_back(vec3_t<T>(rnd<T>(), rnd<T>(), rnd<T>()));
+            vec4s.push_back(vec4_t<T>(rnd<T>(), rnd<T>(), rnd<T>(), rnd<T>()));
+            quats.push_back(q);
+            planes.push_back(plane_t<T>(rnd<T>(), rnd<T>(), rnd<T>(), rnd<T>()));
+            rays.push_back(ray_t<T>(vec3s.back(), axis));
+        }
+    }
+};
+
+template<class T>
+void register_type(const std::string& type) {
+    auto d = std::make_shared<data_t<T>>();
+    auto name = [&type](const char* group, const char* op) {
+        return std::string(group) + "<" + type + ">/" + op;
+    };
+
+    add(name("mat4x4", "multiply"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(d->mats[i % N] * d->mats[(i + 1) % N]);
+        }
+    });
+    add(name("mat4x4", "inverse"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(!d->mats[i % N]);
+        }
+    });
+    add(name("mat4x4", "inverse_affine"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(inverse_affine(d->mats[i % N]));
+        }
+    });
+    add(name("mat4x4", "determinant"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(d->mats[i % N].determinant());
+        }
+    });
+    add(name("mat4x4", "transpose"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(transpose(d->mats[i % N]));
+        }
+    });
+    add(name("vec3", "mul_mat4x4"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(d->vec3s[i % N] * d->mats[(i / N) % N]);
+        }
+    });
+    add(name("vec4", "mul_mat4x4"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(d->vec4s[i % N] * d->mats[(i / N) % N]);
+        }
+    });
+    add(name("vec3", "transform_points"), [d](size_t n) {
+        vec3_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            transform_points(out, d->vec3s.data(), d->mats[(i / N) % N], N);
+            keep(out);
+        }
+    });
+    add(name("skin", "vertices"), [d](size_t n) {
+        mat4x3_t<T> palette[N];
+        unsigned char bones[N * 4];
+        T weights[N * 4];
+        vec3_t<T> positions[N], normals[N];
+        for (size_t i = 0; i < N; ++i) {
+            palette[i] = mat4x3_t<T>(d->quats[i], d->vec3s[i]);
+            for (size_t k = 0; k < 4; ++k) {
+                bones[i * 4 + k] = (unsigned char)((i * 7 + k * 31) % N);
+                weights[i * 4 + k] = T(0.25);
+            }
+        }
+        for (size_t i = 0; i < n; i += N) {
+            skin_vertices(positions, normals, d->vec3s.data(), d->vec3s.data(), bones, weights, palette, 0, N);
+            keep(positions);
+            keep(normals);
+        }
+    });
+    add(name("skin", "vertices_dualquat"), [d](size_t n) {
+        dualquat_t<T> palette[N];
+        unsigned char bones[N * 4];
+        T weights[N * 4];
+        vec3_t<T> positions[N], normals[N];
+        for (size_t i = 0; i < N; ++i) {
+            palette[i] = dualquat_t<T>(d->quats[i], d->vec3s[i]);
+            for (size_t k = 0; k < 4; ++k) {
+                bones[i * 4 + k] = (unsigned char)((i * 7 + k * 31) % N);
+                weights[i * 4 + k] = T(0.25);
+            }
+        }
+        for (size_t i = 0; i < n; i += N) {
+            skin_vertices(positions, normals, d->vec3s.data(), d->vec3s.data(), bones, weights, palette, 0, N);
+            keep(positions);
+            keep(normals);
+        }
+    });
+    add(name("aabb", "transform"), [d](size_t n) {
+        aabb_t<T> box(vec3_t<T>(-1, -1, -1), vec3_t<T>(1, 1, 1));
+        for (size_t i = 0; i < n; ++i) {
+            keep(box * d->mats[i % N]);
+        }
+    });
+    add(name("aabb", "compute_bounds"), [d](size_t n) {
+        for (size_t i = 0; i < n; i += N) {
+            keep(compute_bounds(d->vec3s.data(), N));
+        }
+    });
+    add(name("frustum", "classify_spheres"), [d](size_t n) {
+        auto f = frustum_t<T>::perspective(mat4x4_t<T>::perspectiveLH(T(1), T(1.5), T(0.1), T(2)), T(0.1), T(2));
+        T radii[N];
+        cull_result out[N];
+        for (size_t i = 0; i < N; ++i) {
+            radii[i] = T(0.1);
+        }
+        for (size_t i = 0; i < n; i += N) {
+            classify_spheres(f, d->vec3s.data(), radii, N, out);
+            keep(out);
+        }
+    });
+    add(name("frustum", "classify_boxes"), [d](size_t n) {
+        auto f = frustum_t<T>::perspective(mat4x4_t<T>::perspectiveLH(T(1), T(1.5), T(0.1), T(2)), T(0.1), T(2));
+        vec3_t<T> maxs[N];
+        cull_result out[N];
+        for (size_t i = 0; i < N; ++i) {
+            maxs[i] = d->vec3s[i] + vec3_t<T>(T(0.2), T(0.2), T(0.2));
+        }
+        for (size_t i = 0; i < n; i += N) {
+            classify_boxes(f, d->vec3s.data(), maxs, N, out);
+            keep(out);
+        }
+    });
+    add(name("quat", "multiply"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(d->quats[i % N] * d->quats[(i + 1) % N]);
+        }
+    });
+    add(name("quat", "slerp"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(quat_t<T>::slerp(d->quats[i % N], d->quats[(i + 1) % N], T(0.3)));
+        }
+    });
+    add(name("quat", "slerp_fast"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(quat_t<T>::slerp_fast(d->quats[i % N], d->quats[(i + 1) % N], T(0.3)));
+        }
+    });
+    add(name("quat", "slerp_array"), [d](size_t n) {
+        T scales[N];
+        quat_t<T> out[N];
+        for (size_t i = 0; i < N; ++i) {
+            scales[i] = T(i) / N;
+        }
+        for (size_t i = 0; i < n; i += N) {
+            for (size_t j = 0; j < N - 1; ++j) {
+                out[j] = quat_t<T>::slerp(d->quats[j], d->quats[j + 1], scales[j]);
+            }
+            keep(out);
+        }
+    });
+    add(name("quat", "slerp_fast_array"), [d](size_t n) {
+        T scales[N];
+        quat_t<T> out[N];
+        for (size_t i = 0; i < N; ++i) {
+            scales[i] = T(i) / N;
+        }
+        for (size_t i = 0; i < n; i += N) {
+            slerp_fast(out, d->quats.data(), d->quats.data() + 1, scales, N - 1);
+            keep(out);
+        }
+    });
+    add(name("quat", "nlerp_array"), [d](size_t n) {
+        T scales[N];
+        quat_t<T> out[N];
+        for (size_t i = 0; i < N; ++i) {
+            scales[i] = T(i) / N;
+        }
+        for (size_t i = 0; i < n; i += N) {
+            nlerp(out, d->quats.data(), d->quats.data() + 1, scales, N - 1);
+            keep(out);
+        }
+    });
+    add(name("quat", "from_matrix"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(quat_t<T>::from_matrix(d->rots[i % N]));
+        }
+    });
+    add(name("trig", "sincos"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            T s, c;
+            sincos(d->vec3s[i % N].x * 3, s, c);
+            keep(s + c);
+        }
+    });
+    add(name("trig", "sincos_fast"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            T s, c;
+            sincos_fast(d->vec3s[i % N].x * 3, s, c);
+            keep(s + c);
+        }
+    });
+    add(name("trig", "sincos_fast_array"), [d](size_t n) {
+        T x[N], s[N], c[N];
+        for (size_t i = 0; i < N; ++i) {
+            x[i] = d->vec3s[i].x * 3;
+        }
+        for (size_t i = 0; i < n; i += N) {
+            sincos_fast(s, c, x, N);
+            keep(s);
+            keep(c);
+        }
+    });
+    add(name("quat", "rotation_euler_array"), [d](size_t n) {
+        quat_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            for (size_t j = 0; j < N; ++j) {
+                out[j] = quat_t<T>::rotation(d->vec3s[j].x, d->vec3s[j].y, d->vec3s[j].z);
+            }
+            keep(out);
+        }
+    });
+    add(name("quat", "from_euler"), [d](size_t n) {
+        quat_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            quat_from_euler(out, d->vec3s.data(), N);
+            keep(out);
+        }
+    });
+    add(name("mat4x4", "rotation_euler_array"), [d](size_t n) {
+        mat4x4_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            for (size_t j = 0; j < N; ++j) {
+                out[j] = mat4x4_t<T>::rotation(d->vec3s[j].x, d->vec3s[j].y, d->vec3s[j].z);
+            }
+            keep(out);
+        }
+    });
+    add(name("mat4x4", "from_euler"), [d](size_t n) {
+        mat4x4_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            mat_from_euler(out, d->vec3s.data(), N);
+            keep(out);
+        }
+    });
+    add(name("quat", "pack32"), [d](size_t n) {
+        unsigned int out[N];
+        for (size_t i = 0; i < n; i += N) {
+            pack_quats32(out, d->quats.data(), N);
+            keep(out);
+        }
+    });
+    add(name("quat", "unpack32"), [d](size_t n) {
+        unsigned int packed[N];
+        quat_t<T> out[N];
+        pack_quats32(packed, d->quats.data(), N);
+        for (size_t i = 0; i < n; i += N) {
+            unpack_quats32(out, packed, N);
+            keep(out);
+        }
+    });
+    add(name("quat", "pack64"), [d](size_t n) {
+        unsigned long long out[N];
+        for (size_t i = 0; i < n; i += N) {
+            pack_quats64(out, d->quats.data(), N);
+            keep(out);
+        }
+    });
+    add(name("quat", "unpack64"), [d](size_t n) {
+        unsigned long long packed[N];
+        quat_t<T> out[N];
+        pack_quats64(packed, d->quats.data(), N);
+        for (size_t i = 0; i < n; i += N) {
+            unpack_quats64(out, packed, N);
+            keep(out);
+        }
+    });
+    add(name("vec2", "normalize"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(normalize(d->vec2s[i % N]));
+        }
+    });
+    add(name("vec3", "normalize"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(normalize(d->vec3s[i % N]));
+        }
+    });
+    add(name("vec4", "normalize"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(normalize(d->vec4s[i % N]));
+        }
+    });
+    add(name("quat", "normalize"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(normalize(d->quats[i % N]));
+        }
+    });
+    add(name("plane", "normalize"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(normalize(d->planes[i % N]));
+        }
+    });
+    add(name("vec3", "normalize_fast"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(normalize_fast(d->vec3s[i % N]));
+        }
+    });
+    add(name("vec2", "normalize_fast_array"), [d](size_t n) {
+        vec2_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            normalize_fast(out, d->vec2s.data(), N);
+            keep(out);
+        }
+    });
+    add(name("vec3", "normalize_fast_array"), [d](size_t n) {
+        vec3_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            normalize_fast(out, d->vec3s.data(), N);
+            keep(out);
+        }
+    });
+    add(name("vec4", "normalize_fast_array"), [d](size_t n) {
+        vec4_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            normalize_fast(out, d->vec4s.data(), N);
+            keep(out);
+        }
+    });
+    add(name("quat", "normalize_fast_array"), [d](size_t n) {
+        quat_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            normalize_fast(out, d->quats.data(), N);
+            keep(out);
+        }
+    });
+    add(name("plane", "normalize_fast_array"), [d](size_t n) {
+        plane_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            normalize_fast(out, d->planes.data(), N);
+            keep(out);
+        }
+    });
+    add(name("plane", "dot"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(dot(d->planes[i % N], d->vec3s[(i + 1) % N]));
+        }
+    });
+    add(name("plane", "from_points"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(plane_t<T>(d->vec3s[i % N], d->vec3s[(i + 1) % N], d->vec3s[(i + 2) % N]));
+        }
+    });
+    add(name("ray", "normalize"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(normalize(d->rays[i % N]));
+        }
+    });
+    add(name("ray", "unproject"), [d](size_t n) {
+        auto proj = mat4x4_t<T>::perspectiveLH(T(1), T(1.5), T(0.1), T(100));
+        for (size_t i = 0; i < n; ++i) {
+            keep(unproject<T>(int(i % 1920), int(i % 1080), 1920, 1080, d->mats[i % N], proj));
+        }
+    });
+    add(name("ray", "intersect_aabb"), [d](size_t n) {
+        aabb_t<T> box(vec3_t<T>(-1, -1, -1), vec3_t<T>(1, 1, 1));
+        for (size_t i = 0; i < n; ++i) {
+            auto& r = d->rays[i % N];
+            vec3_t<T> invDir(1 / r.dir.x, 1 / r.dir.y, 1 / r.dir.z);
+            T t;
+            keep(intersect_aabb(r.pos, invDir, box, T(100), t));
+            keep(t);
+        }
+    });
+    add(name("ray", "intersect_triangle"), [d](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            T t, u, v;
+            keep(intersect_triangle(d->rays[i % N], d->vec3s[(i + 1) % N], d->vec3s[(i + 2) % N], d->vec3s[(i + 3) % N], t, u, v));
+            keep(t);
+        }
+    });
+    add(name("ray4", "intersect_aabb"), [d](size_t n) {
+        aabb_t<T> box(vec3_t<T>(-1, -1, -1), vec3_t<T>(1, 1, 1));
+        T tMax[4] = { 100, 100, 100, 100 };
+        T t[4];
+        for (size_t i = 0; i < n; i += 4) {
+            ray4_t<T> r(&d->rays[i % N]);
+            keep(intersect_aabb(r, box, tMax, t));
+            keep(t);
+        }
+    });
+    add(name("ray4", "intersect_triangle"), [d](size_t n) {
+        for (size_t i = 0; i < n; i += 4) {
+            ray4_t<T> r(&d->rays[i % N]);
+            T t[4], u[4], v[4];
+            keep(intersect_triangle(r, d->vec3s[(i + 1) % N], d->vec3s[(i + 2) % N], d->vec3s[(i + 3) % N], t, u, v));
+            keep(t);
+        }
+    });
+
+    // Triangle soup of a bumpy sphere, with rays shot from outside towards it
+    auto mesh = std::make_shared<std::vector<vec3_t<T>>>();
+    const int rings = 128, segments = 256;
+    auto point = [](int i, int j) {
+        auto theta = T(PI) * i / rings;
+        auto phi = 2 * T(PI) * j / segments;
+        auto radius = 1 + T(0.05) * sin(phi * 7) * sin(theta * 5);
+        return vec3_t<T>(sin(theta) * cos(phi), cos(theta), sin(theta) * sin(phi)) * radius;
+    };
+    for (int i = 0; i < rings; ++i) {
+        for (int j = 0; j < segments; ++j) {
+            mesh->push_back(point(i, j));
+            mesh->push_back(point(i + 1, j));
+            mesh->push_back(point(i + 1, j + 1));
+            mesh->push_back(point(i, j));
+            mesh->push_back(point(i + 1, j + 1));
+            mesh->push_back(point(i, j + 1));
+        }
+    }
+    auto tree = std::make_shared<bvh_t<T>>(mesh->data(), mesh->size() / 3);
+    auto probes = std::make_shared<std::vector<ray_t<T>>>();
+    for (size_t i = 0; i < N; ++i) {
+        auto pos = normalize(d->vec3s[i]) * T(3);
+        probes->push_back(ray_t<T>(pos, d->vec3s[(i + 1) % N] * T(0.5) - pos));
+    }
+
+    add(name("bvh", "build"), [mesh](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            bvh_t<T> b(mesh->data(), mesh->size() / 3);
+            keep(b.nodes.size());
+        }
+    });
+#if defined(ZMATH_THREADS)
+    add(name("bvh", "build_mt"), [mesh](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            bvh_t<T> b(mesh->data(), mesh->size() / 3, 4, 0);
+            keep(b.nodes.size());
+        }
+    });
+#endif
+    add(name("bvh", "intersect"), [tree, probes](size_t n) {
+        bvh_hit_t<T> hit;
+        for (size_t i = 0; i < n; ++i) {
+            keep(tree->intersect((*probes)[i % N], hit));
+            keep(hit);
+        }
+    });
+    add(name("bvh", "occluded"), [tree, probes](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(tree->occluded((*probes)[i % N]));
+        }
+    });
+
+    // One image row of N pixels
+    auto pixels = std::make_shared<std::vector<color4_t<T>>>();
+    auto pixels8 = std::make_shared<std::vector<unsigned char>>();
+    for (size_t i = 0; i < N; ++i) {
+        auto v = d->vec4s[i] * T(0.5) + vec4_t<T>(T(0.5), T(0.5), T(0.5), T(0.5));
+        pixels->push_back(color4_t<T>(v.x, v.y, v.z, v.w));
+        for (int c = 0; c < 4; ++c) {
+            pixels8->push_back((unsigned char)(i * 4 + c));
+        }
+    }
+
+    add(name("srgb", "to_linear"), [pixels](size_t n) {
+        color4_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            for (size_t j = 0; j < N; ++j) {
+                out[j] = srgb_to_linear((*pixels)[j]);
+            }
+            keep(out);
+        }
+    });
+    add(name("srgb", "to_linear_fast"), [pixels](size_t n) {
+        color4_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            srgb_to_linear_fast(out, pixels->data(), N);
+            keep(out);
+        }
+    });
+    add(name("srgb", "from_linear"), [pixels](size_t n) {
+        color4_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            for (size_t j = 0; j < N; ++j) {
+                out[j] = linear_to_srgb((*pixels)[j]);
+            }
+            keep(out);
+        }
+    });
+    add(name("srgb", "from_linear_fast"), [pixels](size_t n) {
+        color4_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            linear_to_srgb_fast(out, pixels->data(), N);
+            keep(out);
+        }
+    });
+    add(name("srgb", "rgba8_to_linear"), [pixels8](size_t n) {
+        color4_t<T> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            srgba8_to_linear(out, pixels8->data(), N);
+            keep(out);
+        }
+    });
+    add(name("srgb", "linear_to_rgba8"), [pixels](size_t n) {
+        unsigned char out[N * 4];
+        for (size_t i = 0; i < n; i += N) {
+            linear_to_srgba8(out, pixels->data(), N);
+            keep(out);
+        }
+    });
+
+    add(name("color", "pack_rgba8"), [pixels](size_t n) {
+        unsigned int out[N];
+        for (size_t i = 0; i < n; i += N) {
+            pack_rgba8(out, pixels->data(), N);
+            keep(out);
+        }
+    });
+    add(name("color", "unpack_rgba8"), [pixels](size_t n) {
+        unsigned int packed[N];
+        color4_t<T> out[N];
+        pack_rgba8(packed, pixels->data(), N);
+        for (size_t i = 0; i < n; i += N) {
+            unpack_rgba8(out, packed, N);
+            keep(out);
+        }
+    });
+    add(name("color", "pack_rgb565"), [pixels](size_t n) {
+        color3_t<T> in[N];
+        unsigned short out[N];
+        for (size_t j = 0; j < N; ++j) {
+            in[j] = (*pixels)[j].rgb();
+        }
+        for (size_t i = 0; i < n; i += N) {
+            pack_rgb565(out, in, N);
+            keep(out);
+        }
+    });
+    add(name("color", "pack_r11g11b10f"), [pixels](size_t n) {
+        color3_t<T> in[N];
+        unsigned int out[N];
+        for (size_t j = 0; j < N; ++j) {
+            in[j] = (*pixels)[j].rgb() * T(100);
+        }
+        for (size_t i = 0; i < n; i += N) {
+            pack_r11g11b10f(out, in, N);
+            keep(out);
+        }
+    });
+    add(name("color", "pack_rgb9e5"), [pixels](size_t n) {
+        color3_t<T> in[N];
+        unsigned int out[N];
+        for (size_t j = 0; j < N; ++j) {
+            in[j] = (*pixels)[j].rgb() * T(100);
+        }
+        for (size_t i = 0; i < n; i += N) {
+            pack_rgb9e5(out, in, N);
+            keep(out);
+        }
+    });
+
+    add(name("camera", "relative_batch"), [d](size_t n) {
+        auto eye = d->vec3s[0];
+        auto view = camera_relative_view(mat4x4_t<T>::lookatLH(eye, d->vec3s[1], vec3_t<T>(0, 1, 0)));
+        mat4x4_t<float> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            camera_relative(out, d->mats.data(), eye, view, N);
+            keep(out);
+        }
+    });
+
+    // Scene of one root with 64 characters of 64 nodes each; every node
+    // of a character hangs off the previous one or the character root
+    auto scene = std::make_shared<hierarchy_t<T>>();
+    scene->add(-1, vec3_t<T>(0, 0, 0), quat_t<T>());
+    for (int c = 0; c < 64; ++c) {
+        auto root = scene->add(0, d->vec3s[c], d->quats[c]);
+        auto prev = root;
+        for (int j = 1; j < 64; ++j) {
+            prev = scene->add((j % 8 == 0) ? root : prev, d->vec3s[(c + j) % N], d->quats[(c + j) % N]);
+        }
+    }
+    scene->update();
+
+    add(name("hierarchy", "update_all"), [scene](size_t n) {
+        for (size_t i = 0; i < n; i += scene->size()) {
+            scene->mark(0);
+            scene->update();
+            keep(scene->worlds[1]);
+        }
+    });
+#if defined(ZMATH_THREADS)
+    add(name("hierarchy", "update_all_mt"), [scene](size_t n) {
+        for (size_t i = 0; i < n; i += scene->size()) {
+            scene->mark(0);
+            scene->update(0);
+            keep(scene->worlds[1]);
+        }
+    });
+#endif
+    add(name("hierarchy", "update_sparse"), [scene, d](size_t n) {
+        for (size_t i = 0; i < n; i += scene->size()) {
+            for (int j = 0; j < 16; ++j) {
+                scene->set_rotation(int(j * 257 + 60), d->quats[(i + j) % N]);
+            }
+            scene->update();
+            keep(scene->worlds[1]);
+        }
+    });
+
+    // 64-bone clip with 32 keys per track, played back at 60 fps
+    const size_t bones = 64, keys = 32;
+    auto clip = std::make_shared<anim_clip_t<T>>(bones);
+    for (size_t b = 0; b < bones; ++b) {
+        for (size_t k = 0; k < keys; ++k) {
+            auto time = T(k) / 10;
+            clip->translations[b].times.push_back(time);
+            clip->translations[b].values.push_back(d->vec3s[(b + k) % N]);
+            clip->rotations[b].times.push_back(time);
+            clip->rotations[b].values.push_back(d->quats[(b * 3 + k) % N]);
+        }
+        clip->translations[b].interp = TRACK_CATMULL_ROM;
+    }
+    auto packedClip = std::make_shared<anim_clip_t<T>>(*clip);
+    for (size_t b = 0; b < bones; ++b) {
+        packedClip->translations[b].quantize();
+        packedClip->rotations[b].quantize();
+    }
+
+    add(name("anim", "sample_track"), [clip](size_t n) {
+        track_cursor_t cursor;
+        auto& track = clip->rotations[0];
+        for (size_t i = 0; i < n; ++i) {
+            keep(track.sample(T(i % 186) / 60, cursor));
+        }
+    });
+    add(name("anim", "sample_pose"), [clip](size_t n) {
+        pose_sampler_t<T> sampler(bones);
+        vec3_t<T> translations[bones];
+        quat_t<T> rotations[bones];
+        for (size_t i = 0; i < n; i += bones) {
+            sampler.sample(*clip, T(i / bones % 186) / 60, translations, rotations, nullptr);
+            keep(translations);
+            keep(rotations);
+        }
+    });
+    add(name("anim", "sample_pose_quantized"), [packedClip](size_t n) {
+        pose_sampler_t<T> sampler(bones);
+        vec3_t<T> translations[bones];
+        quat_t<T> rotations[bones];
+        for (size_t i = 0; i < n; i += bones) {
+            sampler.sample(*packedClip, T(i / bones % 186) / 60, translations, rotations, nullptr);
+            keep(translations);
+            keep(rotations);
+        }
+    });
+}
+
+// Lockstep math in float and fixed point; the inputs match across types
+template<class T>
+void register_scalar(const std::string& type) {
+    auto d = std::make_shared<data_t<float>>();
+    auto vecs = std::make_shared<std::vector<vec3_t<T>>>();
+    auto quats = std::make_shared<std::vector<quat_t<T>>>();
+    for (size_t i = 0; i < N; ++i) {
+        vecs->push_back(vec3_t<T>(d->vec3s[i] * 4.0f));
+        quats->push_back(quat_t<T>(d->quats[i]));
+    }
+    auto name = [&type](const char* op) {
+        return "scalar<" + type + ">/" + op;
+    };
+
+    add(name("sqrt"), [vecs](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(sqrt(fabs((*vecs)[i % N].x)));
+        }
+    });
+    add(name("sin"), [vecs](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(sin((*vecs)[i % N].x));
+        }
+    });
+    add(name("atan2"), [vecs](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(atan2((*vecs)[i % N].x, (*vecs)[i % N].y));
+        }
+    });
+    add(name("normalize"), [vecs](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep(normalize((*vecs)[i % N]));
+        }
+    });
+    add(name("quat_multiply"), [quats](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep((*quats)[i % N] * (*quats)[(i + 1) % N]);
+        }
+    });
+    add(name("mat3x3_transform"), [vecs, quats](size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            keep((*vecs)[i % N] * mat3x3_t<T>((*quats)[(i + 1) % N]));
+        }
+    });
+}
+
+// Storage conversions of N float vec3s, e.g. one batch of vertex normals
+void register_half() {
+    auto d = std::make_shared<data_t<float>>();
+    auto packed = std::make_shared<std::vector<vec3_t<half>>>(N);
+    float_to_half(packed->data(), d->vec3s.data(), N);
+
+    add("half/from_float", [d](size_t n) {
+        vec3_t<half> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            float_to_half(out, d->vec3s.data(), N);
+            keep(out);
+        }
+    });
+    add("half/to_float", [packed](size_t n) {
+        vec3_t<float> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            half_to_float(out, packed->data(), N);
+            keep(out);
+        }
+    });
+    add("half/vec3_construct", [d](size_t n) {
+        vec3_t<half> out[N];
+        for (size_t i = 0; i < n; i += N) {
+            for (size_t j = 0; j < N; ++j) {
+                out[j] = vec3_t<half>(d->vec3s[j]);
+            }
+            keep(out);
+        }
+    });
+}
+
+bench_result measure(const bench_case& c, double minTime) {
+    typedef std::chrono::high_resolution_clock clock;
+    size_t n = 1;
+
+    for (;;) {
+        auto start = clock::now();
+        c.run(n);
+        double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+
+        if (elapsed >= minTime || n >= (size_t(1) << 40)) {
+            return bench_result{c.name, n, elapsed * 1e9 / n};
+        }
+
+        // Aim slightly past the target, growing at most 10x per round
+        auto next = (elapsed > 0) ? n * minTime * 1.4 / elapsed : n * 10.0;
+        n = (next > n * 10.0) ? n * 10 : ((next < n + 1.0) ? n + 1 : size_t(next));
+    }
+}
+
+const char* simd_backend() {
+#if defined(ZMATH_SIMD_NEON)
+    return "neon";
+#elif defined(ZMATH_SIMD_FMA)
+    return "sse+fma";
+#elif defined(ZMATH_SIMD_AVX)
+    return "sse+avx";
+#elif defined(ZMATH_SIMD_SSE)
+    return "sse";
+#else
+    return "none";
+#endif
+}
+
+void write_json(FILE* f, const std::vector<bench_result>& results) {
+    fprintf(f, "{\n  \"context\": {\n");
+    fprintf(f, "    \"library\": \"zmath\",\n");
+    fprintf(f, "    \"simd\": \"%s\",\n", simd_backend());
+#if defined(__VERSION__)
+    fprintf(f, "    \"compiler\": \"%s\"\n", __VERSION__);
+#else
+    fprintf(f, "    \"compiler\": \"unknown\"\n");
+#endif
+    fprintf(f, "  },\n  \"benchmarks\": [\n");
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        auto& r = results[i];
+        fprintf(f, "    {\"name\": \"%s\", \"iterations\": %zu, \"real_time\": %.4f, \"time_unit\": \"ns\", \"items_per_second\": %.1f}%s\n",
+                r.name.c_str(), r.iterations, r.ns_per_op, 1e9 / r.ns_per_op, (i + 1 < results.size()) ? "," : "");
+    }
+
+    fprintf(f, "  ]\n}\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string filter;
+    std::string jsonPath;
+    bool json = false;
+    double minTime = 0.1;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--filter=", 9) == 0) {
+            filter = argv[i] + 9;
+        } else if (strncmp(argv[i], "--min_time=", 11) == 0) {
+            minTime = atof(argv[i] + 11);
+        } else if (strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (strncmp(argv[i], "--json=", 7) == 0) {
+            json = true;
+            jsonPath = argv[i] + 7;
+        } else {
+            fprintf(stderr, "usage: %s [--filter=<substring>] [--min_time=<seconds>] [--json[=<file>]]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    register_type<float>("float");
+    register_type<double>("double");
+    register_half();
+    register_scalar<float>("float");
+    register_scalar<fixed32>("fixed32");
+    register_scalar<fixed64>("fixed64");
+
+    std::vector<bench_result> results;
+
+    if (!json || !jsonPath.empty()) {
+        printf("%-36s %14s %12s %16s\n", "Benchmark", "Iterations", "ns/op", "ops/s");
+    }
+
+    for (auto& c : registry()) {
+        if (!filter.empty() && c.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        auto r = measure(c, minTime);
+        results.push_back(r);
+
+        if (!json || !jsonPath.empty()) {
+            printf("%-36s %14zu %12.3f %16.0f\n", r.name.c_str(), r.iterations, r.ns_per_op, 1e9 / r.ns_per_op);
+            fflush(stdout);
+        }
+    }
+
+    if (json) {
+        auto f = jsonPath.empty() ? stdout : fopen(jsonPath.c_str(), "w");
+
+        if (!f) {
+            fprintf(stderr, "cannot open %s\n", jsonPath.c_str());
+            return 1;
+        }
+
+        write_json(f, results);
+
+        if (f != stdout) {
+            fclose(f);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+vec3 random_vec3(float range) {
+    return vec3(test_rnd<float>(-range, range), test_rnd<float>(-range, range), test_rnd<float>(-range, range));
+}
+
+// Any affine matrix: rotation, shear, negative scale and translation alike
+mat4x4 random_affine() {
+    auto m = mat4x4::identity();
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            m.m[i][j] = test_rnd<float>(-2, 2) * ((i == 3) ? 10 : 1);
+        }
+    }
+    return m;
+}
+
+aabb random_box() {
+    auto a = random_vec3(5), b = random_vec3(5);
+    return aabb(minimize(a, b), maximize(a, b));
+}
+
+// Bounds of the eight transformed corners, in double
+aabbd transform_corners(const aabb& box, const mat4x4& m) {
+    auto r = aabbd::empty();
+    for (int c = 0; c < 8; ++c) {
+        vec3d p((c & 1) ? box.max.x : box.min.x, (c & 2) ? box.max.y : box.min.y, (c & 4) ? box.max.z : box.min.z);
+        vec3d q(m.m41, m.m42, m.m43);
+        for (int j = 0; j < 3; ++j) {
+            q.x += p[j] * m.m[j][0];
+            q.y += p[j] * m.m[j][1];
+            q.z += p[j] * m.m[j][2];
+        }
+        r = merge(r, q);
+    }
+    return r;
+}
+
+template<class T>
+double distance(const aabb_t<T>& a, const aabbd& b) {
+    double d = 0;
+    for (int k = 0; k < 3; ++k) {
+        d = std::max(d, std::max(fabs(a.min[k] - b.min[k]), fabs(a.max[k] - b.max[k])));
+    }
+    return d;
+}
+
+} // namespace
+
+// Arvo's method (SIMD for float) gives the bounds of the transformed corners
+TEST(aabb_transform_matches_corners) {
+    double error = 0, errord = 0;
+
+    for (int i = 0; i < 5000; ++i) {
+        auto box = random_box();
+        auto m = random_affine();
+        auto expected = transform_corners(box, m);
+        auto r = box * m;
+        auto rd = aabbd(box) * mat4x4d(m);
+        error = std::max(error, distance(r, expected));
+        errord = std::max(errord, distance(rd, expected));
+
+        auto assigned = box;
+        assigned *= m;
+        CHECK(assigned == r);
+    }
+
+    // Coordinates reach about 50
+    CHECK_LE(error, 2e-5);
+    CHECK_LE(errord, 1e-12);
+
+    auto box = random_box();
+    CHECK(box * mat4x4::identity() == box);
+    CHECK((aabb::empty() * random_affine()).is_empty());
+
+    // A box under a rotation by 45 degrees about z grows by sqrt(2) in x and y
+    auto r = aabb(vec3(-1, -1, -1), vec3(1, 1, 1)) * mat4x4::rotationZ(0.78539816f);
+    CHECK_LE(fabs(r.max.x - 1.41421356), 1e-6);
+    CHECK_LE(fabs(r.min.y + 1.41421356), 1e-6);
+    CHECK_LE(fabs(r.max.z - 1), 1e-6);
+}
+
+// The SIMD compute_bounds equals a plain loop for every count, including
+// those that leave a scalar tail, and for unaligned input
+TEST(compute_bounds_matches_scalar) {
+    std::vector<vec3> points(1031);
+    std::vector<vec3d> pointsd(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        points[i] = random_vec3(100);
+        pointsd[i] = vec3d(points[i]);
+    }
+
+    std::vector<size_t> counts;
+    for (size_t n = 0; n <= 33; ++n) {
+        counts.push_back(n);
+    }
+    counts.push_back(1027);
+    counts.push_back(1030);
+
+    for (auto count : counts) {
+        for (size_t offset = 0; offset < 2; ++offset) {
+            auto p = points.data() + offset;
+            auto expected = aabb::empty();
+            for (size_t i = 0; i < count; ++i) {
+                for (int k = 0; k < 3; ++k) {
+                    expected.min[k] = std::min(expected.min[k], p[i][k]);
+                    expected.max[k] = std::max(expected.max[k], p[i][k]);
+                }
+            }
+
+            CHECK(compute_bounds(p, count) == expected);
+
+            // The empty double box does not convert to float
+            auto d = compute_bounds(pointsd.data() + offset, count);
+            CHECK(count ? aabb(d) == expected : d == aabbd::empty());
+        }
+    }
+
+    CHECK(compute_bounds(points.data(), 0) == aabb::empty());
+}
@@ -0,0 +1,192 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+vec3 random_vec3(float range) {
+    return vec3(test_rnd<float>(-range, range), test_rnd<float>(-range, range), test_rnd<float>(-range, range));
+}
+
+// count small triangles scattered through [-10, 10]^3
+std::vector<vec3> random_triangles(size_t count) {
+    std::vector<vec3> v(count * 3);
+    for (size_t i = 0; i < count; ++i) {
+        auto center = random_vec3(10);
+        for (int k = 0; k < 3; ++k) {
+            v[i * 3 + k] = center + random_vec3(1);
+        }
+    }
+    return v;
+}
+
+// From outside the triangles towards a point among them
+ray random_ray() {
+    auto pos = random_vec3(15);
+    return ray(pos, random_vec3(10) - pos);
+}
+
+bool brute_intersect(const std::vector<vec3>& v, const ray& r, bvh_hit_t<float>& hit) {
+    auto tMax = std::numeric_limits<float>::max();
+    bool found = false;
+
+    for (size_t i = 0; i < v.size() / 3; ++i) {
+        float t, u, vv;
+        if (intersect_triangle(r, v[i * 3], v[i * 3 + 1], v[i * 3 + 2], t, u, vv) && t < tMax) {
+            tMax = hit.t = t;
+            hit.u = u;
+            hit.v = vv;
+            hit.triangle = (unsigned int)i;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+bool brute_occluded(const std::vector<vec3>& v, const ray& r, float tMax) {
+    for (size_t i = 0; i < v.size() / 3; ++i) {
+        float t, u, vv;
+        if (intersect_triangle(r, v[i * 3], v[i * 3 + 1], v[i * 3 + 2], t, u, vv) && t < tMax) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Every input triangle is in exactly one leaf, leaves hold at most
+// maxLeafSize of them and every node bounds its subtree
+void check_tree(const bvh& b, const std::vector<vec3>& v, size_t maxLeafSize) {
+    auto count = v.size() / 3;
+    std::vector<int> seen(count);
+    CHECK(b.triangles.size() == count && b.vertices.size() == v.size());
+
+    for (auto& node : b.nodes) {
+        if (node.count == 0) {
+            CHECK(node.index < b.nodes.size());
+            continue;
+        }
+
+        CHECK(node.count <= maxLeafSize);
+        for (auto k = node.index; k < node.index + node.count; ++k) {
+            ++seen[b.triangles[k]];
+            for (int j = 0; j < 3; ++j) {
+                CHECK(b.vertices[k * 3 + j] == v[b.triangles[k] * 3 + j]);
+                CHECK(node.bounds.contains(b.vertices[k * 3 + j]));
+            }
+        }
+    }
+
+    for (size_t i = 0; i + 1 < b.nodes.size(); ++i) {
+        if (b.nodes[i].count == 0) {
+            CHECK(b.nodes[i].bounds.contains(b.nodes[i + 1].bounds));
+            CHECK(b.nodes[i].bounds.contains(b.nodes[b.nodes[i].index].bounds));
+        }
+    }
+
+    CHECK(std::count(seen.begin(), seen.end(), 1) == std::ptrdiff_t(count));
+}
+
+// Traversal finds the same closest hit as testing every triangle. Both run
+// the same intersect_triangle on the same vertices, so t is exact.
+void check_queries(const bvh& b, const std::vector<vec3>& v, int rays) {
+    int hits = 0;
+
+    for (int i = 0; i < rays; ++i) {
+        auto r = random_ray();
+        bvh_hit_t<float> expected, hit;
+        auto found = brute_intersect(v, r, expected);
+        CHECK(b.intersect(r, hit) == found);
+
+        if (found) {
+            CHECK(hit.t == expected.t && hit.triangle == expected.triangle);
+            CHECK(hit.u == expected.u && hit.v == expected.v);
+            ++hits;
+        }
+
+        auto tMax = test_rnd<float>(0, 2);
+        CHECK(b.occluded(r, tMax) == brute_occluded(v, r, tMax));
+    }
+
+    // Enough rays hit for the comparison to mean something
+    CHECK(hits > rays / 10);
+}
+
+} // namespace
+
+TEST(bvh_matches_brute_force) {
+    auto v = random_triangles(3000);
+    bvh b(v.data(), 3000);
+    check_tree(b, v, 4);
+    check_queries(b, v, 20000);
+}
+
+TEST(bvh_empty) {
+    bvh b(nullptr, 0);
+    bvh_hit_t<float> hit;
+    auto r = ray(vec3(0, 0, 0), vec3(1, 0, 0));
+    CHECK(b.nodes.empty() && b.vertices.empty() && b.triangles.empty());
+    CHECK(!b.intersect(r, hit) && !b.occluded(r));
+
+    // Rebuilding with nothing clears a previous tree
+    auto v = random_triangles(10);
+    b.build(v.data(), 10);
+    CHECK(!b.nodes.empty());
+    b.build(v.data(), 0);
+    CHECK(b.nodes.empty() && b.vertices.empty() && b.triangles.empty());
+    CHECK(!b.intersect(r, hit) && !b.occluded(r));
+}
+
+// Triangles whose bounds all share one center leave SAH nothing to split
+// on, so the build falls back to median splits
+TEST(bvh_degenerate_centroids) {
+    const size_t count = 1000;
+    std::vector<vec3> v(count * 3);
+
+    // Each triangle spans [-s, s] on every axis
+    for (size_t i = 0; i < count; ++i) {
+        auto s = test_rnd<float>(0.1f, 10);
+        v[i * 3 + 0] = vec3(-s, -s, -s);
+        v[i * 3 + 1] = vec3(s, test_rnd(-s, s), test_rnd(-s, s));
+        v[i * 3 + 2] = vec3(test_rnd(-s, s), s, s);
+    }
+
+    bvh b(v.data(), count, 4);
+    check_tree(b, v, 4);
+    CHECK(b.nodes.size() < count);
+    check_queries(b, v, 2000);
+}
+
+// With ZMATH_THREADS the top levels are built concurrently; the result must
+// be the serial tree, node for node. Without it threads is ignored.
+TEST(bvh_threaded_build_matches_serial) {
+    auto v = random_triangles(20000);
+    bvh serial(v.data(), 20000, 4, 1);
+
+    for (unsigned threads : { 0u, 2u, 7u }) {
+        bvh b(v.data(), 20000, 4, threads);
+        CHECK(b.nodes.size() == serial.nodes.size());
+        CHECK(memcmp(b.nodes.data(), serial.nodes.data(), serial.nodes.size() * sizeof(bvh_node_t<float>)) == 0);
+        CHECK(b.triangles == serial.triangles);
+        CHECK(b.vertices == serial.vertices);
+    }
+}
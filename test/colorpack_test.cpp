@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+// Every code in each channel: code i goes to all four channels, 2-bit alpha wraps
+std::vector<unsigned int> unorm_codes(int bits, int alphaBits) {
+    std::vector<unsigned int> v(1u << bits);
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        v[i] = i | i << bits | i << (2 * bits) | (i & ((1u << alphaBits) - 1)) << (3 * bits);
+    }
+    return v;
+}
+
+bool same(const color4& a, const color4& b) {
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+bool same(const color3& a, const color3& b) {
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+} // namespace
+
+// Array unpacks (SIMD for float) match the single-value ones bit for bit,
+// and every code packs back to itself
+TEST(colorpack_unorm_round_trip) {
+    typedef void (*unpack_array)(color4*, const unsigned int*, size_t);
+    typedef void (*pack_array)(unsigned int*, const color4*, size_t);
+    typedef color4 (*unpack_one)(unsigned int);
+    typedef unsigned int (*pack_one)(const color4&);
+
+    struct Format {
+        std::vector<unsigned int> codes;
+        unpack_array unpackArray;
+        pack_array packArray;
+        unpack_one unpack;
+        pack_one pack;
+    } formats[] = {
+        { unorm_codes(8, 8), unpack_rgba8<float>, pack_rgba8<float>, unpack_rgba8<float>, pack_rgba8<float> },
+        { unorm_codes(8, 8), unpack_bgra8<float>, pack_bgra8<float>, unpack_bgra8<float>, pack_bgra8<float> },
+        { unorm_codes(10, 2), unpack_rgb10a2<float>, pack_rgb10a2<float>, unpack_rgb10a2<float>, pack_rgb10a2<float> },
+    };
+
+    for (auto& f : formats) {
+        // One short of the full set so the scalar tail runs as well
+        auto count = f.codes.size() - 1;
+        std::vector<color4> colors(count);
+        std::vector<unsigned int> back(count);
+        f.unpackArray(colors.data(), f.codes.data(), count);
+        f.packArray(back.data(), colors.data(), count);
+
+        for (size_t i = 0; i < count; ++i) {
+            CHECK(same(colors[i], f.unpack(f.codes[i])));
+            CHECK(back[i] == f.codes[i] && f.pack(colors[i]) == f.codes[i]);
+        }
+    }
+
+    // The end points are exact
+    CHECK(same(unpack_rgba8<float>(0xffffffff), color4(1, 1, 1, 1)));
+    CHECK(same(unpack_rgb10a2<float>(0), color4(0, 0, 0, 0)));
+    CHECK(same(unpack_rgb10a2<float>(0xffffffff), color4(1, 1, 1, 1)));
+}
+
+TEST(colorpack_rgb565_round_trip) {
+    const size_t count = 65535;
+    std::vector<unsigned short> codes(count), back(count);
+    std::vector<color3> colors(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        codes[i] = (unsigned short)i;
+    }
+
+    unpack_rgb565(colors.data(), codes.data(), count);
+    pack_rgb565(back.data(), colors.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(same(colors[i], unpack_rgb565<float>(codes[i])));
+        CHECK(back[i] == codes[i] && pack_rgb565(colors[i]) == codes[i]);
+    }
+
+    CHECK(same(unpack_rgb565<float>(0xffff), color3(1, 1, 1)));
+}
+
+// Array packs (SIMD for float) match the single-value ones, including
+// clamping and NaN
+TEST(colorpack_unorm_pack_simd) {
+    const size_t count = 4095;
+    std::vector<color4> c4(count);
+    std::vector<color3> c3(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        c4[i] = color4(test_rnd(-0.25f, 1.25f), test_rnd(0.0f, 1.0f), test_rnd(0.0f, 1.0f), test_rnd(-0.25f, 1.25f));
+        c3[i] = color3(c4[i].r, c4[i].g, c4[i].b);
+    }
+
+    c4[5].g = c3[5].g = std::numeric_limits<float>::quiet_NaN();
+    c4[count - 1].b = c3[count - 1].b = std::numeric_limits<float>::quiet_NaN();
+
+    std::vector<unsigned int> rgba(count), bgra(count), rgb10(count);
+    std::vector<unsigned short> rgb565(count);
+    pack_rgba8(rgba.data(), c4.data(), count);
+    pack_bgra8(bgra.data(), c4.data(), count);
+    pack_rgb10a2(rgb10.data(), c4.data(), count);
+    pack_rgb565(rgb565.data(), c3.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(rgba[i] == pack_rgba8(c4[i]));
+        CHECK(bgra[i] == pack_bgra8(c4[i]));
+        CHECK(rgb10[i] == pack_rgb10a2(c4[i]));
+        CHECK(rgb565[i] == pack_rgb565(c3[i]));
+    }
+
+    CHECK(pack_rgba8(color4(-1, 2, 0.5f, 1)) == 0xff80ff00);
+    CHECK(((rgba[5] >> 8) & 0xff) == 0);
+}
+
+// Every finite code decodes and encodes back to itself; infinity and NaN
+// keep their class
+TEST(colorpack_r11g11b10f_round_trip) {
+    for (unsigned int c = 0; c < (31u << 6); ++c) {
+        CHECK(ufloat_encode<6>(ufloat_decode<6>(c)) == c);
+    }
+
+    for (unsigned int c = 0; c < (31u << 5); ++c) {
+        CHECK(ufloat_encode<5>(ufloat_decode<5>(c)) == c);
+    }
+
+    CHECK(ufloat_decode<6>(31u << 6) == std::numeric_limits<float>::infinity());
+    CHECK(std::isnan(ufloat_decode<5>(ufloat_encode<5>(std::numeric_limits<float>::quiet_NaN()))));
+    CHECK(ufloat_encode<6>(1e10f) == (31u << 6) - 1);
+    CHECK(ufloat_encode<6>(-1.0f) == 0);
+
+    const size_t count = 1023;
+    std::vector<unsigned int> codes(count), back(count);
+    std::vector<color3> colors(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        unsigned int r, g, b;
+        do {
+            r = (unsigned int)test_rnd(0.0, 2048.0);
+            g = (unsigned int)test_rnd(0.0, 2048.0);
+            b = (unsigned int)test_rnd(0.0, 1024.0);
+        } while (r >= (31u << 6) || g >= (31u << 6) || b >= (31u << 5));
+        codes[i] = r | g << 11 | b << 22;
+    }
+
+    unpack_r11g11b10f(colors.data(), codes.data(), count);
+    pack_r11g11b10f(back.data(), colors.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(back[i] == codes[i]);
+    }
+}
+
+// Codes whose largest mantissa uses the top bit (or that sit at the lowest
+// exponent) are the canonical encodings, and those round trip
+TEST(colorpack_rgb9e5_round_trip) {
+    for (int i = 0; i < 20000; ++i) {
+        auto e = (unsigned int)test_rnd(0.0, 32.0);
+        unsigned int m[3];
+        for (auto& x : m) {
+            x = (unsigned int)test_rnd(0.0, 512.0);
+        }
+        if (e > 0) {
+            m[i % 3] |= 256;
+        }
+
+        auto code = m[0] | m[1] << 9 | m[2] << 18 | e << 27;
+        CHECK(pack_rgb9e5(unpack_rgb9e5<float>(code)) == code);
+    }
+
+    CHECK(pack_rgb9e5(color3(1e10f, -1, std::numeric_limits<float>::quiet_NaN())) == (511u | 31u << 27));
+}
@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+vec3 random_vec3(float range) {
+    return vec3(test_rnd<float>(-range, range), test_rnd<float>(-range, range), test_rnd<float>(-range, range));
+}
+
+// Every fourth rotation is close to half a turn, where w is near zero and
+// from_matrix takes its other branches
+quat random_rotation(int i) {
+    auto angle = (i % 4 == 0) ? 3.14159f - test_rnd<float>(0, 1e-3f) : test_rnd<float>(-3, 3);
+    return quat::rotation_axis(normalize(random_vec3(1)), angle);
+}
+
+// A point transformed by a matrix in double, rows as in skin_vertices
+vec3d transform(const mat4x3& m, const vec3& p) {
+    return vec3d(p.x * double(m.m11) + p.y * double(m.m21) + p.z * double(m.m31) + m.m41,
+                 p.x * double(m.m12) + p.y * double(m.m22) + p.z * double(m.m32) + m.m42,
+                 p.x * double(m.m13) + p.y * double(m.m23) + p.z * double(m.m33) + m.m43);
+}
+
+double distance(const vec3& a, const vec3d& b) {
+    return std::max(std::max(fabs(a.x - b.x), fabs(a.y - b.y)), fabs(a.z - b.z));
+}
+
+double distance(const mat4x3& a, const mat4x3& b) {
+    double d = 0;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            d = std::max(d, fabs(double(a.m[i][j]) - b.m[i][j]));
+        }
+    }
+    return d;
+}
+
+// Distance up to the sign, which does not change the transform
+double distance(const dualquat& a, const dualquat& b) {
+    auto s = (dot(a.real, b.real) < 0) ? -1.0 : 1.0;
+    double d = 0;
+    const float* pa = &a.real.x;
+    const float* pb = &b.real.x;
+    for (int i = 0; i < 4; ++i) {
+        d = std::max(d, fabs(pa[i] - s * pb[i]));
+        d = std::max(d, fabs(pa[i + 4] - s * pb[i + 4]));
+    }
+    return d;
+}
+
+} // namespace
+
+// dualquat_t and mat4x3_t convert both ways without losing the transform
+TEST(dualquat_mat4x3_round_trip) {
+    double toMatrix = 0, fromMatrix = 0, both = 0;
+
+    for (int i = 0; i < 2000; ++i) {
+        auto q = random_rotation(i);
+        auto pos = random_vec3(10);
+        dualquat dq(q, pos);
+        mat4x3 m(q, pos);
+
+        toMatrix = std::max(toMatrix, distance(mat4x3(dq), m));
+        fromMatrix = std::max(fromMatrix, distance(dualquat(m), dq));
+        both = std::max(both, distance(mat4x3(dualquat(m)), m));
+    }
+
+    // Translations are up to 17 long, so 1e-5 is a few ulp of them
+    CHECK_LE(toMatrix, 1e-5);
+    CHECK_LE(fromMatrix, 1e-5);
+    CHECK_LE(both, 1e-5);
+
+    CHECK(mat4x3(dualquat()) == mat4x3::identity());
+    CHECK(dualquat(mat4x3::identity()) == dualquat());
+}
+
+TEST(dualquat_transform_point) {
+    double point = 0, vector = 0, composed = 0, inverse = 0;
+
+    for (int i = 0; i < 2000; ++i) {
+        auto qa = random_rotation(i), qb = random_rotation(i + 1);
+        auto ta = random_vec3(10), tb = random_vec3(10);
+        dualquat a(qa, ta), b(qb, tb);
+        mat4x3 ma(qa, ta), mb(qb, tb);
+        auto p = random_vec3(5);
+
+        point = std::max(point, distance(transform_point(a, p), transform(ma, p)));
+        vector = std::max(vector, distance(transform_vector(a, p), transform(mat4x3(qa), p)));
+
+        // a * b applies a first, as affine_multiply(ma, mb) does
+        auto ab = a * b;
+        composed = std::max(composed, distance(transform_point(ab, p), transform(affine_multiply(ma, mb), p)));
+        composed = std::max(composed, distance(transform_point(ab, p), vec3d(transform_point(b, transform_point(a, p)))));
+        inverse = std::max(inverse, distance(transform_point(!a, transform_point(a, p)), vec3d(p)));
+    }
+
+    CHECK_LE(point, 2e-5);
+    CHECK_LE(vector, 5e-6);
+    CHECK_LE(composed, 4e-5);
+    CHECK_LE(inverse, 4e-5);
+}
+
+// With one bone influencing each vertex, however the weight is spread over
+// the four slots, DQS and LBS both reduce to that bone's rigid transform.
+// The DQS palette also holds every bone negated, which is the same rotation
+// and must not cancel in the blend.
+TEST(dualquat_blend_single_bone) {
+    const size_t bones = 8, vertices = 503;
+    std::vector<mat4x3> matrices;
+    std::vector<dualquat> dqs;
+
+    for (size_t i = 0; i < bones; ++i) {
+        auto q = random_rotation(int(i));
+        auto t = random_vec3(10);
+        matrices.push_back(mat4x3(q, t));
+        dqs.push_back(dualquat(q, t));
+    }
+
+    for (size_t i = 0; i < bones; ++i) {
+        dqs.push_back(-dqs[i]);
+    }
+
+    std::vector<vec3> positions(vertices), normals(vertices);
+    std::vector<vec3> lbsPositions(vertices), lbsNormals(vertices), dqsPositions(vertices), dqsNormals(vertices);
+    std::vector<unsigned char> lbsBones(vertices * 4), dqsBones(vertices * 4);
+    std::vector<float> weights(vertices * 4);
+
+    for (size_t i = 0; i < vertices; ++i) {
+        positions[i] = random_vec3(2);
+        normals[i] = normalize(random_vec3(1));
+        auto bone = (unsigned char)(i % bones);
+        float sum = 0;
+
+        for (size_t k = 0; k < 4; ++k) {
+            weights[i * 4 + k] = (i % 3 == 0 && k > 0) ? 0 : test_rnd<float>(0.1f, 1);
+            sum += weights[i * 4 + k];
+            lbsBones[i * 4 + k] = bone;
+            dqsBones[i * 4 + k] = (unsigned char)(bone + ((k % 2) ? bones : 0));
+        }
+
+        for (size_t k = 0; k < 4; ++k) {
+            weights[i * 4 + k] /= sum;
+        }
+    }
+
+    skin_vertices(lbsPositions.data(), lbsNormals.data(), positions.data(), normals.data(), lbsBones.data(),
+                  weights.data(), matrices.data(), 0, vertices);
+    skin_vertices(dqsPositions.data(), dqsNormals.data(), positions.data(), normals.data(), dqsBones.data(),
+                  weights.data(), dqs.data(), 0, vertices);
+
+    double lbs = 0, dq = 0, normal = 0;
+
+    for (size_t i = 0; i < vertices; ++i) {
+        auto& m = matrices[i % bones];
+        auto expected = transform(m, positions[i]);
+        lbs = std::max(lbs, distance(lbsPositions[i], expected));
+        dq = std::max(dq, distance(dqsPositions[i], expected));
+        normal = std::max(normal, distance(dqsNormals[i], vec3d(lbsNormals[i])));
+    }
+
+    CHECK_LE(lbs, 2e-5);
+    CHECK_LE(dq, 2e-5);
+    CHECK_LE(normal, 2e-6);
+
+    // blend of one bone is that bone, whichever sign
+    const float one = 1;
+    CHECK_LE(distance(blend(&dqs[bones + 3], &one, 1), dqs[3]), 1e-6);
+}
@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+const double SQRT_IN[6] = { 0, 1e-3, 0.5, 2, 100, 12345.678 };
+const double ANGLE_IN[9] = { 0, 0.5, 1, -2, 3, 10, -100, 1000, 20000 };
+const double ATAN2_IN[6][2] = { { 1, 1 }, { 1, -1 }, { -2, 0.5 }, { 0, -1 }, { 3, 4 }, { -1e-2, -5 } };
+const double NORMALIZE_IN[4][3] = { { 1, 2, 3 }, { 1e-3, -2e-3, 0 }, { 100, -50, 25 }, { 0, 0, -7 } };
+
+// Raw results for the inputs above. They are the same on every platform,
+// so a change here is a change in the results every client computes.
+struct raw_results {
+    long long sqrt[6], sin[9], cos[9], atan2[6], normalize[4][3];
+};
+
+const raw_results FIXED32_RAW = {
+    { 0, 2079, 46340, 92681, 655360, 7281777 },
+    { 0, 31420, 55147, -59592, 9248, -35654, 33186, 54191, 38141 },
+    { 65537, 57513, 35409, -27273, -64881, -54990, 56513, 36855, 53293 },
+    { 51472, 154415, -86890, 205887, 42172, -205757 },
+    { { 17515, 35031, 52546 }, { 29488, -58528, 0 }, { 57205, -28602, 14301 }, { 0, 0, -65536 } },
+};
+
+const raw_results FIXED64_RAW = {
+    { 0, 135818786, 3037000499, 6074000999, 42949672960, 477218568878 },
+    { 0, 2059117010, 3614090361, -3905402711, 606105820, -2336552880, 2174823869, 3551420585, 2499605520 },
+    { 4294967297, 3769188403, 2320580735, -1787337054, -4251985397, -3603784777, 3703631356, 2415399742,
+      3492666077 },
+    { 3373259428, 10119778277, -5694343506, 13493037705, 2763816216, -13484447783 },
+    { { 1147878294, 2295756587, 3443634881 }, { 1920767588, -3841535624, 0 },
+      { 3748954808, -1874477404, 937238702 }, { 0, 0, -4294967295 } },
+};
+
+template<class T>
+void check_raw_results(const raw_results& expected) {
+    for (int i = 0; i < 6; ++i) {
+        CHECK(sqrt(T(SQRT_IN[i])).raw == expected.sqrt[i]);
+        CHECK(atan2(T(ATAN2_IN[i][0]), T(ATAN2_IN[i][1])).raw == expected.atan2[i]);
+    }
+
+    for (int i = 0; i < 9; ++i) {
+        CHECK(sin(T(ANGLE_IN[i])).raw == expected.sin[i]);
+        CHECK(cos(T(ANGLE_IN[i])).raw == expected.cos[i]);
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        auto n = normalize(vec3_t<T>(T(NORMALIZE_IN[i][0]), T(NORMALIZE_IN[i][1]), T(NORMALIZE_IN[i][2])));
+        CHECK(n.x.raw == expected.normalize[i][0]);
+        CHECK(n.y.raw == expected.normalize[i][1]);
+        CHECK(n.z.raw == expected.normalize[i][2]);
+    }
+}
+
+// sin and cos reduce the ends of the range without overflowing
+template<class T>
+void check_range_ends(double tolerance) {
+    typedef std::numeric_limits<T> limits;
+    T ends[] = { limits::max(), limits::lowest(), T::from_raw(limits::max().raw - 3),
+                 T::from_raw(limits::lowest().raw + 3) };
+
+    for (auto x : ends) {
+        CHECK_LE(fabs(double(sin(x)) - std::sin(double(x))), tolerance);
+        CHECK_LE(fabs(double(cos(x)) - std::cos(double(x))), tolerance);
+    }
+
+    auto n = normalize(vec3_t<T>(limits::lowest(), T(0), T(1)));
+    CHECK(n.x == T(-1) && n.y == T(0));
+}
+
+uint64_t random_bits() {
+    return uint64_t(test_rng()()) << 32 | test_rng()();
+}
+
+} // namespace
+
+TEST(fixed32_raw_results) {
+    check_raw_results<fixed32>(FIXED32_RAW);
+    check_range_ends<fixed32>(1e-4);
+}
+
+TEST(fixed64_raw_results) {
+    check_raw_results<fixed64>(FIXED64_RAW);
+    check_range_ends<fixed64>(1e-8);
+}
+
+// The portable 64-bit paths give the same bits as the __int128 ones, for
+// operands of every magnitude and sign, overflowing results included
+TEST(fixed64_portable_mul_div) {
+#if defined(__SIZEOF_INT128__)
+    const int fractions[] = { 2, 16, 32, 48, 62 };
+
+    for (int i = 0; i < 20000; ++i) {
+        auto a = int64_t(random_bits()) >> (test_rng()() % 64);
+        auto b = int64_t(random_bits()) >> (test_rng()() % 64);
+        auto f = fractions[i % 5];
+
+        CHECK(fixed_mul_portable(a, b, f) == fixed_mul(a, b, f));
+
+        if (b != 0) {
+            CHECK(fixed_div_portable(a, b, f) == fixed_div(a, b, f));
+        }
+    }
+
+    const int64_t ends[] = { INT64_MIN, INT64_MIN + 1, -1, 1, INT64_MAX };
+
+    for (auto a : ends) {
+        for (auto b : ends) {
+            CHECK(fixed_mul_portable(a, b, 32) == fixed_mul(a, b, 32));
+            CHECK(fixed_div_portable(a, b, 32) == fixed_div(a, b, 32));
+        }
+    }
+#endif
+}
@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+// Signed distance of the point on the view axis at depth z (+z for LH, -z for RH)
+template<class T>
+T axis_distance(const plane_t<T>& p, T z) {
+    return dot(p, vec3_t<T>(0, 0, z));
+}
+
+} // namespace
+
+TEST(frustum_perspective_near_far) {
+    const float minZ = 1, maxZ = 100;
+
+    auto lh = frustum::perspective(mat4x4::perspectiveLH(1, 1, minZ, maxZ), minZ, maxZ);
+    CHECK_LE(fabs(axis_distance(lh.planes[frustum::PLANE_NEAR], minZ)), 1e-4);
+    CHECK_LE(fabs(axis_distance(lh.planes[frustum::PLANE_FAR], maxZ)), 1e-3);
+    CHECK(lh.contains(vec3(0, 0, 50)));
+    CHECK(!lh.contains(vec3(0, 0, 0.99f)));
+    CHECK(!lh.contains(vec3(0, 0, 100.1f)));
+
+    auto rh = frustum::perspective(mat4x4::perspectiveRH(1, 1, minZ, maxZ), minZ, maxZ);
+    CHECK_LE(fabs(axis_distance(rh.planes[frustum::PLANE_NEAR], -minZ)), 1e-4);
+    CHECK_LE(fabs(axis_distance(rh.planes[frustum::PLANE_FAR], -maxZ)), 1e-3);
+    CHECK(rh.contains(vec3(0, 0, -50)));
+    CHECK(!rh.contains(vec3(0, 0, -100.1f)));
+
+    auto d = frustumd::perspective(mat4x4d::perspectiveLH(1, 1, 1, 100), 1.0, 100.0);
+    CHECK_LE(fabs(axis_distance(d.planes[frustumd::PLANE_NEAR], 1.0)), 1e-9);
+    CHECK_LE(fabs(axis_distance(d.planes[frustumd::PLANE_FAR], 100.0)), 1e-9);
+}
+
+TEST(frustum_ortho_near_far) {
+    auto lh = frustum(mat4x4::orthoLH(4, 4, 2, 50), CLIP_DEPTH_ZERO_TO_ONE);
+    CHECK_LE(fabs(axis_distance(lh.planes[frustum::PLANE_NEAR], 2.0f)), 1e-5);
+    CHECK_LE(fabs(axis_distance(lh.planes[frustum::PLANE_FAR], 50.0f)), 1e-4);
+
+    auto rh = frustum(mat4x4::orthoRH(4, 4, 2, 50), CLIP_DEPTH_ZERO_TO_ONE);
+    CHECK_LE(fabs(axis_distance(rh.planes[frustum::PLANE_NEAR], -2.0f)), 1e-5);
+    CHECK_LE(fabs(axis_distance(rh.planes[frustum::PLANE_FAR], -50.0f)), 1e-4);
+}
+
+// The float versions run on SIMD and the double ones are generic; both must
+// classify alike and leave plane indices in a cache they share.
+TEST(frustum_batch_cache_shared) {
+    const size_t count = 512;
+    auto view = mat4x4::lookatLH(vec3(0, 0, -5), vec3(0, 0, 0), vec3(0, 1, 0));
+    auto f = frustum::perspective(view * mat4x4::perspectiveLH(1, 1.5f, 0.5f, 20), 0.5f, 20);
+    frustumd fd;
+    for (int i = 0; i < frustum::PLANE_COUNT; ++i) {
+        fd.planes[i] = planed(f.planes[i]);
+    }
+
+    std::vector<vec3> centers(count), maxs(count);
+    std::vector<vec3d> centersd(count), maxsd(count);
+    std::vector<float> radii(count);
+    std::vector<double> radiid(count);
+    for (size_t i = 0; i < count; ++i) {
+        centers[i] = vec3(test_rnd<float>(-20, 20), test_rnd<float>(-20, 20), test_rnd<float>(-10, 25));
+        radii[i] = test_rnd<float>(0.1f, 2);
+        maxs[i] = centers[i] + vec3(radii[i], radii[i], radii[i]);
+        centersd[i] = vec3d(centers[i]);
+        radiid[i] = radii[i];
+        maxsd[i] = vec3d(maxs[i]);
+    }
+
+    std::vector<cull_result> results(count), resultsd(count);
+    std::vector<unsigned char> cache(count, 0), cached(count, 0);
+
+    classify_spheres(f, centers.data(), radii.data(), count, results.data(), cache.data());
+    classify_spheres(fd, centersd.data(), radiid.data(), count, resultsd.data(), cached.data());
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(results[i] == resultsd[i]);
+        if (results[i] == CULL_OUTSIDE) {
+            CHECK(cache[i] < frustum::PLANE_COUNT);
+            CHECK(dot(f.planes[cache[i] % frustum::PLANE_COUNT], centers[i]) < -radii[i]);
+        }
+    }
+
+    // Swap the caches between the paths
+    classify_spheres(f, centers.data(), radii.data(), count, results.data(), cached.data());
+    classify_spheres(fd, centersd.data(), radiid.data(), count, resultsd.data(), cache.data());
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(results[i] == resultsd[i]);
+    }
+
+    classify_boxes(f, centers.data(), maxs.data(), count, results.data(), cache.data());
+    classify_boxes(fd, centersd.data(), maxsd.data(), count, resultsd.data(), cache.data());
+    for (size_t i = 0; i < count; ++i) {
+        CHECK(results[i] == resultsd[i]);
+        CHECK(cache[i] < frustum::PLANE_COUNT);
+    }
+}
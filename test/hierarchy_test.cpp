@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+// Three roots with 700 nodes each, enough for update(threads) to split them
+// into tasks. Each node hangs off the previous one or one of its ancestors.
+void build_scene(hierarchy& h) {
+    for (int r = 0; r < 3; ++r) {
+        auto prev = h.add(-1, vec3(test_rnd<float>(-5, 5), 0, 0), quat());
+        for (int j = 1; j < 700; ++j) {
+            auto parent = prev;
+            for (int up = (int)test_rnd<float>(0, 3); up > 0 && h.parents[parent] >= 0; --up) {
+                parent = h.parents[parent];
+            }
+            auto axis = normalize(vec3(test_rnd<float>(-1, 1), test_rnd<float>(-1, 1), test_rnd<float>(-1, 1)));
+            prev = h.add(parent, vec3(test_rnd<float>(-1, 1), test_rnd<float>(-1, 1), test_rnd<float>(-1, 1)),
+                         quat::rotation_axis(axis, test_rnd<float>(-1, 1)),
+                         vec3(test_rnd<float>(0.8f, 1.25f), test_rnd<float>(0.8f, 1.25f), test_rnd<float>(0.8f, 1.25f)));
+        }
+    }
+}
+
+// World matrices as 4x4 products: scale, rotate, translate, then the parent
+void check_worlds(const hierarchy& h) {
+    std::vector<mat4x4> ref(h.size());
+    double maxError = 0;
+    for (size_t i = 0; i < h.size(); ++i) {
+        auto local = mat4x4::scale(h.scales[i]) * mat4x4(h.rotations[i]) * mat4x4::translation(h.translations[i]);
+        auto p = h.parents[i];
+        ref[i] = (p >= 0) ? local * ref[p] : local;
+
+        auto& w = h.worlds[i];
+        const float got[4][3] = {
+            { w.m11, w.m12, w.m13 }, { w.m21, w.m22, w.m23 }, { w.m31, w.m32, w.m33 }, { w.m41, w.m42, w.m43 },
+        };
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                maxError = std::max(maxError, fabs(got[r][c] - ref[i].m[r][c]) / std::max(1.0, fabs(ref[i].m[r][c])));
+            }
+        }
+    }
+    CHECK_LE(maxError, 1e-4);
+}
+
+bool same_worlds(const hierarchy& a, const hierarchy& b) {
+    return a.size() == b.size() && memcmp(a.worlds.data(), b.worlds.data(), a.size() * sizeof(mat4x3)) == 0;
+}
+
+} // namespace
+
+TEST(hierarchy_update_matches_products) {
+    hierarchy serial, threaded;
+    build_scene(serial);
+    threaded = serial;
+
+    serial.update();
+    threaded.update(4);
+    check_worlds(serial);
+    CHECK(same_worlds(serial, threaded));
+
+    // Dirty locals deep in a subtree, on a root and on a leaf
+    const int nodes[] = { 5, 700, 1399, 1500, 2099 };
+    for (auto i : nodes) {
+        auto q = quat::rotation_axis(vec3(0, 1, 0), float(i) / 1000);
+        serial.set_rotation(i, q);
+        threaded.set_rotation(i, q);
+    }
+    serial.set_translation(1, vec3(2, 3, 4));
+    threaded.set_translation(1, vec3(2, 3, 4));
+
+    serial.update();
+    threaded.update(4);
+    check_worlds(serial);
+    CHECK(same_worlds(serial, threaded));
+
+    // Nothing is dirty any more
+    for (size_t i = 0; i < serial.size(); ++i) {
+        CHECK(serial.flags[i] == 0 && threaded.flags[i] == 0);
+    }
+}
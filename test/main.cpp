@@ -0,0 +1,58 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+int main(int argc, char** argv) {
+    std::string filter;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--filter=", 9) == 0) {
+            filter = argv[i] + 9;
+        } else {
+            fprintf(stderr, "usage: %s [--filter=<substring>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    int run = 0;
+    int failed = 0;
+
+    for (auto& c : test_registry()) {
+        if (!filter.empty() && c.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        auto before = test_failures();
+        c.run();
+        ++run;
+
+        if (test_failures() != before) {
+            ++failed;
+            printf("FAIL %s\n", c.name.c_str());
+        } else {
+            printf("ok   %s\n", c.name.c_str());
+        }
+    }
+
+    printf("%d of %d tests passed\n", run - failed, run);
+    return failed == 0 ? 0 : 1;
+}
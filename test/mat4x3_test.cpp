@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+// The product of two affine transforms, a first
+mat4x3 combine(const mat4x3& a, const mat4x3& b) {
+    return affine_multiply(a, b);
+}
+
+void check_identity(const mat4x3& p, double tolerance) {
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            CHECK_LE(fabs(p.m[i][j] - (i == j ? 1 : 0)), tolerance);
+        }
+    }
+}
+
+mat4x3 random_rigid() {
+    auto axis = normalize(vec3(test_rnd<float>(-1, 1), test_rnd<float>(-1, 1), test_rnd<float>(-1, 1)));
+    return combine(mat4x3::rotation(axis, test_rnd<float>(-3, 3)),
+                   mat4x3::translation(test_rnd<float>(-10, 10), test_rnd<float>(-10, 10), test_rnd<float>(-10, 10)));
+}
+
+} // namespace
+
+TEST(mat3x3_inverse_small_scale) {
+    // det = 1.25e-7 is about epsilon; det = 1e-12 far below it
+    auto a = !mat3x3::scale(0.005f, 0.005f, 0.005f);
+    CHECK(float_eq(a.m11, 200.0f) && float_eq(a.m22, 200.0f) && float_eq(a.m33, 200.0f));
+    auto b = !mat3x3::scale(1e-4f, 1e-4f, 1e-4f);
+    CHECK(float_eq(b.m11, 1e4f) && b.m12 == 0);
+    auto c = !mat2x2_t<float>(1e-4f, 0, 0, 1e-4f);
+    CHECK(float_eq(c.m11, 1e4f) && float_eq(c.m22, 1e4f));
+}
+
+TEST(mat4x3_inverse_affine) {
+    // det of the 3x3 part is 6.4e-8, below epsilon
+    auto inv = inverse_affine(combine(mat4x3::scale(0.004f), mat4x3::translation(1, -1, 0)));
+    CHECK(float_eq(inv.m11, 250.0f) && float_eq(inv.m22, 250.0f) && float_eq(inv.m33, 250.0f));
+    CHECK(float_eq(inv.m41, -250.0f) && float_eq(inv.m42, 250.0f) && inv.m43 == 0);
+
+    for (int n = 0; n < 100; ++n) {
+        auto m = combine(mat4x3::scale(test_rnd<float>(0.001f, 0.01f), test_rnd<float>(0.5f, 2), test_rnd<float>(0.5f, 2)), random_rigid());
+        check_identity(combine(m, inverse_affine(m)), 1e-3);
+        check_identity(combine(inverse_affine(m), m), 1e-3);
+    }
+
+    auto d = inverse_affine(affine_multiply(mat4x3d::scale(0.004), mat4x3d::translation(1, -1, 0)));
+    CHECK(float_eq(d.m11, 250.0) && float_eq(d.m41, -250.0) && float_eq(d.m42, 250.0));
+}
+
+TEST(mat4x3_inverse_rigid) {
+    for (int n = 0; n < 100; ++n) {
+        auto m = random_rigid();
+        auto inv = inverse_rigid(m);
+        check_identity(combine(m, inv), 1e-5);
+
+        auto affine = inverse_affine(m);
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                CHECK_LE(fabs(inv.m[i][j] - affine.m[i][j]), 1e-5);
+            }
+        }
+    }
+}
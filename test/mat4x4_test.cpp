@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+mat4x4_t<float> random_mat4x4() {
+    mat4x4_t<float> m;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            m.m[i][j] = test_rnd<float>(-4, 4);
+        }
+    }
+    return m;
+}
+
+// The loop of the generic mat4x4_t::operator *, which the float SIMD
+// specialization replaces
+mat4x4_t<float> generic_multiply(const mat4x4_t<float>& a, const mat4x4_t<float>& b) {
+    mat4x4_t<float> tmp;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            tmp.m[i][j] = 0;
+            for (int k = 0; k < 4; ++k) {
+                tmp.m[i][j] += a.m[i][k] * b.m[k][j];
+            }
+        }
+    }
+    return tmp;
+}
+
+// Without FMA both sum the same products in the same order and must agree
+// bit for bit. With FMA (x86 FMA3, or the fused vfmaq madd on AArch64 NEON)
+// the products are not rounded, so each element may differ by a few ulp of
+// the sum of the absolute products.
+void check_product(const mat4x4_t<float>& a, const mat4x4_t<float>& b, const mat4x4_t<float>& r) {
+    auto ref = generic_multiply(a, b);
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+#if defined(ZMATH_SIMD_FMA) || (defined(ZMATH_SIMD_NEON) && defined(__aarch64__))
+            float mag = 0;
+            for (int k = 0; k < 4; ++k) {
+                mag += fabs(a.m[i][k] * b.m[k][j]);
+            }
+            CHECK_LE(fabs(r.m[i][j] - ref.m[i][j]), 4 * std::numeric_limits<float>::epsilon() * mag);
+#else
+            CHECK(r.m[i][j] == ref.m[i][j]);
+#endif
+        }
+    }
+}
+
+} // namespace
+
+TEST(mat4x4_multiply_matches_generic) {
+    for (int n = 0; n < 1000; ++n) {
+        auto a = random_mat4x4();
+        auto b = random_mat4x4();
+        check_product(a, b, a * b);
+
+        auto c = a;
+        c *= b;
+        check_product(a, b, c);
+    }
+}
+
+TEST(mat4x4_inverse_small_scale) {
+    // det = 1e-12, far below epsilon, yet perfectly invertible
+    auto m = mat4x4_t<float>::identity() * 1e-3f;
+    m.m44 = 1;
+    auto inv = mat4x4_t<float>::zero();
+    CHECK(try_inverse(m, inv));
+    CHECK(float_eq(inv.m11, 1000.0f) && float_eq(inv.m22, 1000.0f) && float_eq(inv.m33, 1000.0f));
+
+    auto s = !mat4x4_t<float>::scale(0.005f);
+    CHECK(float_eq(s.m11, 200.0f) && float_eq(s.m22, 200.0f) && float_eq(s.m33, 200.0f) && s.m44 == 1);
+
+    auto d = !mat4x4_t<double>::scale(0.005);
+    CHECK(float_eq(d.m11, 200.0) && d.m44 == 1);
+}
+
+TEST(mat4x4_inverse_singular) {
+    auto m = mat4x4_t<float>::scale(2.0f);
+    m.m33 = 0;
+    auto inv = mat4x4_t<float>::identity();
+    CHECK(!try_inverse(m, inv));
+    CHECK(inv == mat4x4_t<float>::identity());
+
+    auto md = mat4x4_t<double>(m);
+    auto invd = mat4x4_t<double>::identity();
+    CHECK(!try_inverse(md, invd));
+    CHECK(invd == mat4x4_t<double>::identity());
+}
+
+TEST(mat4x4_inverse_roundtrip) {
+    for (int n = 0; n < 100; ++n) {
+        auto m = random_mat4x4();
+        auto inv = mat4x4_t<float>::zero();
+        if (!try_inverse(m, inv)) {
+            continue;
+        }
+        auto p = m * inv;
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                CHECK_LE(fabs(p.m[i][j] - (i == j ? 1 : 0)), 1e-3);
+            }
+        }
+    }
+}
+
+namespace {
+
+void check_identity(const mat4x4_t<float>& p, double tolerance) {
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            CHECK_LE(fabs(p.m[i][j] - (i == j ? 1 : 0)), tolerance);
+        }
+    }
+}
+
+} // namespace
+
+TEST(mat4x4_inverse_affine) {
+    // det of the 3x3 part is 6.4e-8, below epsilon
+    auto m = mat4x4_t<float>::scale(0.004f) * mat4x4_t<float>::translation(1, -1, 0);
+    auto inv = inverse_affine(m);
+    CHECK(float_eq(inv.m11, 250.0f) && float_eq(inv.m22, 250.0f) && float_eq(inv.m33, 250.0f));
+    CHECK(float_eq(inv.m41, -250.0f) && float_eq(inv.m42, 250.0f) && inv.m43 == 0 && inv.m44 == 1);
+
+    for (int n = 0; n < 100; ++n) {
+        auto axis = normalize(vec3(test_rnd<float>(-1, 1), test_rnd<float>(-1, 1), test_rnd<float>(-1, 1)));
+        auto a = mat4x4_t<float>::scale(test_rnd<float>(0.001f, 0.01f), test_rnd<float>(0.5f, 2), test_rnd<float>(0.5f, 2)) *
+                 mat4x4_t<float>::rotation(axis, test_rnd<float>(-3, 3)) *
+                 mat4x4_t<float>::translation(test_rnd<float>(-10, 10), test_rnd<float>(-10, 10), test_rnd<float>(-10, 10));
+        check_identity(a * inverse_affine(a), 1e-3);
+    }
+
+    auto d = inverse_affine(mat4x4_t<double>::scale(0.004) * mat4x4_t<double>::translation(1, -1, 0));
+    CHECK(float_eq(d.m11, 250.0) && float_eq(d.m41, -250.0) && float_eq(d.m42, 250.0));
+}
+
+TEST(mat4x4_inverse_rigid) {
+    for (int n = 0; n < 100; ++n) {
+        auto axis = normalize(vec3(test_rnd<float>(-1, 1), test_rnd<float>(-1, 1), test_rnd<float>(-1, 1)));
+        auto m = mat4x4_t<float>::rotation(axis, test_rnd<float>(-3, 3)) *
+                 mat4x4_t<float>::translation(test_rnd<float>(-10, 10), test_rnd<float>(-10, 10), test_rnd<float>(-10, 10));
+        auto inv = inverse_rigid(m);
+        check_identity(m * inv, 1e-5);
+
+        auto affine = inverse_affine(m);
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                CHECK_LE(fabs(inv.m[i][j] - affine.m[i][j]), 1e-5);
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+const size_t COUNT = 4099;
+
+// The bound of rsqrt_fast, see shared.h
+const double RSQRT_ERROR = 3e-7;
+
+// Components spread over several orders of magnitude
+float random_component() {
+    auto v = test_rnd<float>(-1, 1);
+    return v * std::pow(10.0f, test_rnd<float>(-3, 3));
+}
+
+double length_error(double lengthSq) {
+    return fabs(sqrt(lengthSq) - 1);
+}
+
+double length_error(const vec2& v) {
+    return length_error(sqr(double(v.x)) + sqr(double(v.y)));
+}
+
+double length_error(const vec3& v) {
+    return length_error(sqr(double(v.x)) + sqr(double(v.y)) + sqr(double(v.z)));
+}
+
+double length_error(const vec4& v) {
+    return length_error(sqr(double(v.x)) + sqr(double(v.y)) + sqr(double(v.z)) + sqr(double(v.w)));
+}
+
+double length_error(const quat& q) {
+    return length_error(vec4(q.x, q.y, q.z, q.w));
+}
+
+double length_error(const plane& p) {
+    return length_error(p.normal);
+}
+
+// Checks the scalar and array versions of normalize_fast on the same inputs
+template<class V>
+void check_normalize_fast(const std::vector<V>& in) {
+    std::vector<V> out(in.size());
+    normalize_fast(out.data(), in.data(), in.size());
+
+    double scalarMax = 0, arrayMax = 0;
+    for (size_t i = 0; i < in.size(); ++i) {
+        scalarMax = std::max(scalarMax, length_error(normalize_fast(in[i])));
+        arrayMax = std::max(arrayMax, length_error(out[i]));
+    }
+    CHECK_LE(scalarMax, RSQRT_ERROR);
+    CHECK_LE(arrayMax, RSQRT_ERROR);
+}
+
+} // namespace
+
+// Every float in [1, 4), which covers each mantissa for both exponent parities
+TEST(rsqrt_fast_error) {
+    double maxError = 0;
+    for (float x = 1; x < 4; x = std::nextafter(x, 4.0f)) {
+        auto r = double(rsqrt_fast(x));
+        maxError = std::max(maxError, fabs(r * sqrt(double(x)) - 1));
+    }
+    CHECK_LE(maxError, RSQRT_ERROR);
+}
+
+TEST(normalize_fast_length) {
+    std::vector<vec2> v2(COUNT);
+    std::vector<vec3> v3(COUNT);
+    std::vector<vec4> v4(COUNT);
+    std::vector<quat> q(COUNT);
+    std::vector<plane> p(COUNT);
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        v2[i] = vec2(random_component(), random_component());
+        v3[i] = vec3(random_component(), random_component(), random_component());
+        v4[i] = vec4(random_component(), random_component(), random_component(), random_component());
+        q[i] = quat(random_component(), random_component(), random_component(), random_component());
+        p[i] = plane(vec3(random_component(), random_component(), random_component()), random_component());
+    }
+
+    check_normalize_fast(v2);
+    check_normalize_fast(v3);
+    check_normalize_fast(v4);
+    check_normalize_fast(q);
+    check_normalize_fast(p);
+}
@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+TEST(quat_nlerp_array_zero_length) {
+    const size_t count = 11;
+    quat from[count], to[count], out[count];
+    float scales[count];
+
+    for (size_t i = 0; i < count; ++i) {
+        auto axis = normalize(vec3(test_rnd<float>(), test_rnd<float>(), test_rnd<float>()));
+        from[i] = quat::rotation_axis(axis, test_rnd<float>(-3, 3));
+        to[i] = quat::rotation_axis(axis, test_rnd<float>(-3, 3));
+        scales[i] = test_rnd<float>(0, 1);
+    }
+
+    // Zero inputs in a SIMD block and in the scalar tail
+    from[1] = to[1] = quat(0, 0, 0, 0);
+    from[9] = to[9] = quat(0, 0, 0, 0);
+
+    nlerp(out, from, to, scales, count);
+
+    for (size_t i = 0; i < count; ++i) {
+        auto ref = quat::nlerp(from[i], to[i], scales[i]);
+        CHECK_LE(fabs(out[i].x - ref.x), 1e-6);
+        CHECK_LE(fabs(out[i].y - ref.y), 1e-6);
+        CHECK_LE(fabs(out[i].z - ref.z), 1e-6);
+        CHECK_LE(fabs(out[i].w - ref.w), 1e-6);
+    }
+
+    CHECK(out[1] == quat(0, 0, 0, 0));
+    CHECK(out[9] == quat(0, 0, 0, 0));
+}
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+const size_t COUNT = 4099; // not a multiple of four, so the scalar tails run
+
+std::vector<quat> random_unit_quats() {
+    std::vector<quat> q(COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+        q[i] = normalize(quat(test_rnd<float>(), test_rnd<float>(), test_rnd<float>(), test_rnd<float>()));
+    }
+    // Ties and axis-aligned cases
+    q[0] = quat(0, 0, 0, 1);
+    q[1] = quat(0, 0, 0, -1);
+    q[2] = normalize(quat(1, 1, 0, 0));
+    q[3] = normalize(quat(-1, 1, -1, 1));
+    return q;
+}
+
+// Largest component error against q or -q, whichever is closer
+float max_error(const quat& a, const quat& b) {
+    auto e0 = std::max(std::max(fabs(a.x - b.x), fabs(a.y - b.y)), std::max(fabs(a.z - b.z), fabs(a.w - b.w)));
+    auto e1 = std::max(std::max(fabs(a.x + b.x), fabs(a.y + b.y)), std::max(fabs(a.z + b.z), fabs(a.w + b.w)));
+    return std::min(e0, e1);
+}
+
+} // namespace
+
+// The bounds in the quatpack.h table
+TEST(quatpack_round_trip_error) {
+    auto q = random_unit_quats();
+    float e32 = 0, e48 = 0, e64 = 0;
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        e32 = std::max(e32, max_error(q[i], unpack_quat32<float>(pack_quat32(q[i]))));
+        e48 = std::max(e48, max_error(q[i], unpack_quat48<float>(pack_quat48(q[i]))));
+        e64 = std::max(e64, max_error(q[i], unpack_quat64<float>(pack_quat64(q[i]))));
+    }
+
+    CHECK_LE(e32, 2.1e-3);
+    CHECK_LE(e48, 6.5e-5);
+    CHECK_LE(e64, 2.0e-6);
+}
+
+TEST(quatpack_identity_exact) {
+    auto id = quat(0, 0, 0, 1);
+    CHECK(unpack_quat32<float>(pack_quat32(id)) == id);
+    CHECK(unpack_quat48<float>(pack_quat48(id)) == id);
+    CHECK(unpack_quat64<float>(pack_quat64(id)) == id);
+
+    auto idd = quatd(0, 0, 0, 1);
+    CHECK(unpack_quat32<double>(pack_quat32(idd)) == idd);
+    CHECK(unpack_quat64<double>(pack_quat64(idd)) == idd);
+
+    quat ids[5] = { id, id, id, id, id }, out[5];
+    unsigned int codes32[5];
+    pack_quats32(codes32, ids, 5);
+    unpack_quats32(out, codes32, 5);
+    for (int i = 0; i < 5; ++i) {
+        CHECK(out[i] == id);
+    }
+}
+
+// The float array versions run on SIMD; their codes must equal the scalar ones
+TEST(quatpack_array_matches_scalar) {
+    auto q = random_unit_quats();
+    std::vector<unsigned int> c32(COUNT);
+    std::vector<quat48_t> c48(COUNT);
+    std::vector<unsigned long long> c64(COUNT);
+    pack_quats32(c32.data(), q.data(), COUNT);
+    pack_quats48(c48.data(), q.data(), COUNT);
+    pack_quats64(c64.data(), q.data(), COUNT);
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        CHECK(c32[i] == pack_quat32(q[i]));
+        auto s48 = pack_quat48(q[i]);
+        CHECK(memcmp(&c48[i], &s48, sizeof(s48)) == 0);
+        CHECK(c64[i] == pack_quat64(q[i]));
+    }
+
+    std::vector<quat> u32(COUNT), u48(COUNT), u64(COUNT);
+    unpack_quats32(u32.data(), c32.data(), COUNT);
+    unpack_quats48(u48.data(), c48.data(), COUNT);
+    unpack_quats64(u64.data(), c64.data(), COUNT);
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        CHECK_LE(max_error(u32[i], unpack_quat32<float>(c32[i])), 1e-6);
+        CHECK_LE(max_error(u48[i], unpack_quat48<float>(c48[i])), 1e-6);
+        CHECK_LE(max_error(u64[i], unpack_quat64<float>(c64[i])), 1e-6);
+    }
+}
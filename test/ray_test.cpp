@@ -0,0 +1,199 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+vec3 random_vec3(float range) {
+    return vec3(test_rnd<float>(-range, range), test_rnd<float>(-range, range), test_rnd<float>(-range, range));
+}
+
+// Random rays around the origin with directions from 1e-3 to 1e3 long
+ray random_ray() {
+    auto dir = normalize(random_vec3(1)) * std::pow(10.0f, test_rnd<float>(-3, 3));
+    return ray(random_vec3(3), dir);
+}
+
+const vec3 P0(0, 0, 0), P1(1, 0, 0), P2(0, 1, 0);
+
+} // namespace
+
+TEST(ray_triangle_scalar) {
+    float t, u, v;
+    auto down = vec3(0, 0, -1);
+
+    CHECK(intersect_triangle(ray(vec3(0.25f, 0.25f, 1), down), P0, P1, P2, t, u, v));
+    CHECK(t == 1 && u == 0.25f && v == 0.25f);
+
+    // Two-sided, and t is in units of dir
+    CHECK(intersect_triangle(ray(vec3(0.25f, 0.25f, -2), vec3(0, 0, 4)), P0, P1, P2, t, u, v));
+    CHECK(t == 0.5f);
+
+    // Edges and vertices are inside
+    CHECK(intersect_triangle(ray(vec3(0.5f, 0, 1), down), P0, P1, P2, t, u, v) && u == 0.5f && v == 0);
+    CHECK(intersect_triangle(ray(vec3(0, 0.5f, 1), down), P0, P1, P2, t, u, v) && u == 0 && v == 0.5f);
+    CHECK(intersect_triangle(ray(vec3(0, 0, 1), down), P0, P1, P2, t, u, v) && u == 0 && v == 0);
+
+    // Outside, behind the origin, parallel
+    CHECK(!intersect_triangle(ray(vec3(0.75f, 0.75f, 1), down), P0, P1, P2, t, u, v));
+    CHECK(!intersect_triangle(ray(vec3(-0.25f, 0.25f, 1), down), P0, P1, P2, t, u, v));
+    CHECK(!intersect_triangle(ray(vec3(0.25f, 0.25f, 1), -down), P0, P1, P2, t, u, v));
+    CHECK(!intersect_triangle(ray(vec3(-1, 0.25f, 0), vec3(1, 0, 0)), P0, P1, P2, t, u, v));
+
+    // Tiny triangles and short directions shrink det far below epsilon
+    auto s = 1e-4f;
+    auto base = vec3(1e-3f, 2e-3f, 0);
+    CHECK(intersect_triangle(ray(base + vec3(s / 4, s / 4, 1), down), base, base + vec3(s, 0, 0), base + vec3(0, s, 0), t, u, v));
+    CHECK(float_eq(t, 1.0f) && float_eq(u, 0.25f, 1e-3f) && float_eq(v, 0.25f, 1e-3f));
+    CHECK(intersect_triangle(ray(vec3(0.25f, 0.25f, 1), down * 1e-5f), P0, P1, P2, t, u, v));
+    CHECK(float_eq(t, 1e5f));
+}
+
+TEST(ray_plane_scalar) {
+    float t;
+    auto ground = plane(vec3(0, 0, 1), 0.0f);
+
+    CHECK(intersect_plane(ray(vec3(1, 2, 3), vec3(0, 0, -1)), ground, t) && t == 3);
+    CHECK(intersect_plane(ray(vec3(1, 2, -3), vec3(0, 0, 2)), ground, t) && t == 1.5f);
+    CHECK(!intersect_plane(ray(vec3(1, 2, 3), vec3(0, 0, 1)), ground, t));
+    CHECK(!intersect_plane(ray(vec3(1, 2, 3), vec3(1, 0, 0)), ground, t));
+    CHECK(intersect_plane(ray(vec3(1, 2, 3), vec3(0, 0, -1e-6f)), ground, t) && float_eq(t, 3e6f));
+
+    // t would overflow
+    CHECK(!intersect_plane(ray(vec3(0, 0, 1e30f), vec3(1, 0, -1e-30f)), ground, t));
+}
+
+TEST(ray_sphere_aabb_scalar) {
+    float t;
+    auto center = vec3(0, 0, 5);
+
+    CHECK(intersect_sphere(ray(vec3(0, 0, 0), vec3(0, 0, 1)), center, 1.0f, t) && t == 4);
+    CHECK(intersect_sphere(ray(center, vec3(0, 0, 2)), center, 1.0f, t) && t == 0.5f);
+    CHECK(!intersect_sphere(ray(vec3(0, 0, 0), vec3(0, 0, -1)), center, 1.0f, t));
+    CHECK(!intersect_sphere(ray(vec3(0, 2, 0), vec3(0, 0, 1)), center, 1.0f, t));
+
+    auto box = aabb(vec3(-1, -1, 4), vec3(1, 1, 6));
+    CHECK(intersect_aabb(ray(vec3(0, 0, 0), vec3(0, 0, 1)), box, t) && t == 4);
+    CHECK(intersect_aabb(ray(vec3(0, 0, 5), vec3(1, 0, 0)), box, t) && t == 0);
+    CHECK(!intersect_aabb(ray(vec3(0, 0, 0), vec3(0, 0, -1)), box, t));
+    CHECK(!intersect_aabb(ray(vec3(0, 2, 0), vec3(0, 0, 1)), box, t));
+}
+
+// The packet versions must give the scalar mask and distances. Lanes whose
+// double-precision result lies within a margin of a decision boundary are
+// skipped, since the two paths round differently.
+TEST(ray_packet_matches_scalar) {
+    const int count = 20000;
+    const double margin = 1e-3;
+    auto center = vec3(0.5f, -0.25f, 0.25f);
+    auto radius = 0.75f;
+    auto box = aabb(vec3(-1, -0.5f, -0.25f), vec3(0.5f, 1, 0.75f));
+    auto pl = normalize(plane(vec3(0.3f, -0.5f, 0.8f), 0.2f));
+    auto q0 = vec3(-1, -1, 0.5f), q1 = vec3(1.5f, -0.5f, -0.5f), q2 = vec3(0, 1.5f, 0);
+    int checked[4] = {};
+
+    for (int n = 0; n < count; n += 4) {
+        ray rays[4];
+        float tMax[4];
+        for (int i = 0; i < 4; ++i) {
+            rays[i] = random_ray();
+            tMax[i] = (i == 3) ? std::numeric_limits<float>::max() : test_rnd<float>(0, 10);
+        }
+        ray4_t<float> r4(rays);
+
+        float pt[4], st[4], bt[4], tt[4], tu[4], tv[4];
+        auto pm = intersect_plane(r4, pl, pt);
+        auto sm = intersect_sphere(r4, center, radius, st);
+        auto bm = intersect_aabb(r4, box, tMax, bt);
+        auto tm = intersect_triangle(r4, q0, q1, q2, tt, tu, tv);
+
+        for (int i = 0; i < 4; ++i) {
+            auto& r = rays[i];
+            auto rd = rayd(r);
+            float t, u, v;
+            double td, ud, vd;
+
+            // Plane: t away from zero, the ray not within a margin of parallel
+            auto pd = planed(pl);
+            auto denom = dot(pd.normal, rd.dir);
+            if (fabs(denom) > margin * length(rd.dir) &&
+                (!intersect_plane(rd, pd, td) || fabs(td) > margin)) {
+                auto hit = intersect_plane(r, pl, t);
+                CHECK(hit == (((pm >> i) & 1) != 0));
+                if (hit) {
+                    // t = -(dot(n, pos) + d) / denom: rounding of either sum is
+                    // divided by denom, which may be a thousandth of |dir|
+                    auto scale = length(rd.pos) + fabs(pd.dist) + fabs(t) * length(rd.dir);
+                    CHECK_LE(fabs(t - pt[i]), 5e-7 * scale / fabs(denom));
+                }
+                ++checked[0];
+            }
+
+            // Sphere: robust when a slightly smaller and larger sphere agree
+            if (intersect_sphere(rd, vec3d(center), radius * (1 - margin), td) ==
+                intersect_sphere(rd, vec3d(center), radius * (1 + margin), td)) {
+                auto hit = intersect_sphere(r, center, radius, t);
+                CHECK(hit == (((sm >> i) & 1) != 0));
+                if (hit) {
+                    CHECK_LE(fabs(t - st[i]), 1e-4 * std::max(1.0, fabs(t)));
+                }
+                ++checked[1];
+            }
+
+            // Box: the same with a shrunk and a grown box, and t away from tMax
+            auto grow = vec3d(margin, margin, margin);
+            auto inner = aabb_t<double>(vec3d(box.min) + grow, vec3d(box.max) - grow);
+            auto outer = aabb_t<double>(vec3d(box.min) - grow, vec3d(box.max) + grow);
+            auto invd = vec3d(1 / rd.dir.x, 1 / rd.dir.y, 1 / rd.dir.z);
+            if (intersect_aabb(rd.pos, invd, inner, tMax[i] * (1 - margin), td) ==
+                intersect_aabb(rd.pos, invd, outer, tMax[i] * (1 + margin), td)) {
+                auto inv = vec3(r4.ix[i], r4.iy[i], r4.iz[i]);
+                auto hit = intersect_aabb(r.pos, inv, box, tMax[i], t);
+                CHECK(hit == (((bm >> i) & 1) != 0));
+                if (hit) {
+                    CHECK(fabs(t - bt[i]) <= 1e-4 * std::max(1.0, fabs(t)));
+                }
+                ++checked[2];
+            }
+
+            // Triangle: every barycentric weight and t away from zero
+            auto hitd = intersect_triangle(rd, vec3d(q0), vec3d(q1), vec3d(q2), td, ud, vd);
+            auto det = dot(vec3d(q1 - q0), cross(rd.dir, vec3d(q2 - q0)));
+            if (det != 0 && std::isfinite(ud) && std::isfinite(vd) && std::isfinite(td) &&
+                fabs(ud) > margin && fabs(vd) > margin && fabs(1 - ud - vd) > margin && fabs(td) > margin) {
+                auto hit = intersect_triangle(r, q0, q1, q2, t, u, v);
+                CHECK(hit == hitd);
+                CHECK(hit == (((tm >> i) & 1) != 0));
+                if (hit) {
+                    CHECK_LE(fabs(t - tt[i]), 1e-4 * std::max(1.0, fabs(t)));
+                    CHECK_LE(std::max(fabs(u - tu[i]), fabs(v - tv[i])), 1e-4);
+                }
+                ++checked[3];
+            }
+        }
+    }
+
+    // Nearly all lanes are away from the boundaries
+    for (int k = 0; k < 4; ++k) {
+        CHECK(checked[k] > count * 9 / 10);
+    }
+}
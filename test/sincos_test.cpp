@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+const size_t COUNT = (1 << 20) + 3;
+
+// The bound of sincos_fast for |x| < 8192, see shared.h
+const double SINCOS_ERROR = 1e-7;
+
+} // namespace
+
+TEST(sincos_fast_error) {
+    std::vector<float> x(COUNT), s(COUNT), c(COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+        x[i] = test_rnd<float>(-8191, 8191);
+    }
+    sincos_fast(s.data(), c.data(), x.data(), COUNT);
+
+    double scalarMax = 0, arrayMax = 0, doubleMax = 0;
+    for (size_t i = 0; i < COUNT; ++i) {
+        auto es = sin(double(x[i]));
+        auto ec = cos(double(x[i]));
+        float fs, fc;
+        sincos_fast(x[i], fs, fc);
+        double ds, dc;
+        sincos_fast(double(x[i]), ds, dc);
+        scalarMax = std::max(scalarMax, std::max(fabs(fs - es), fabs(fc - ec)));
+        arrayMax = std::max(arrayMax, std::max(fabs(s[i] - es), fabs(c[i] - ec)));
+        doubleMax = std::max(doubleMax, std::max(fabs(ds - es), fabs(dc - ec)));
+    }
+    CHECK_LE(scalarMax, SINCOS_ERROR);
+    CHECK_LE(arrayMax, SINCOS_ERROR);
+    CHECK_LE(doubleMax, SINCOS_ERROR);
+}
+
+// The float batches use simd_sincos, so they only match the factories within
+// the sincos_fast error, see euler.h
+TEST(euler_batch_matches_rotation) {
+    const size_t count = 1027;
+    const double bound = 4e-7;
+    std::vector<vec3> angles(count);
+    for (size_t i = 0; i < count; ++i) {
+        angles[i] = vec3(test_rnd<float>(-4, 4), test_rnd<float>(-4, 4), test_rnd<float>(-4, 4));
+    }
+
+    std::vector<quat> q(count);
+    std::vector<mat4x4> m(count);
+    quat_from_euler(q.data(), angles.data(), count);
+    mat_from_euler(m.data(), angles.data(), count);
+
+    double qMax = 0, mMax = 0;
+    for (size_t i = 0; i < count; ++i) {
+        auto rq = quat::rotation(angles[i].x, angles[i].y, angles[i].z);
+        auto rm = mat4x4::rotation(angles[i].x, angles[i].y, angles[i].z);
+        qMax = std::max(qMax, std::max(std::max(fabs(q[i].x - rq.x), fabs(q[i].y - rq.y)),
+                                       std::max(fabs(q[i].z - rq.z), fabs(q[i].w - rq.w))));
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                mMax = std::max(mMax, fabs(m[i].m[r][c] - rm.m[r][c]));
+            }
+        }
+    }
+    CHECK_LE(qMax, bound);
+    CHECK_LE(mMax, bound);
+}
+
+// ZMATH_FAST_TRIG selects the float sincos for the library's instantiations
+// and for client code alike, so the factories agree with the chosen version
+TEST(sincos_float_selection) {
+    for (int i = 0; i < 1000; ++i) {
+        auto x = test_rnd<float>(-100, 100);
+        float s, c;
+#if defined(ZMATH_FAST_TRIG)
+        sincos_fast(x, s, c);
+#else
+        s = sin(x);
+        c = cos(x);
+#endif
+        float ss, sc;
+        sincos(x, ss, sc);
+        auto m = mat2x2::rotation(x);
+        CHECK(ss == s && sc == c);
+        CHECK(m.m[0][0] == c && m.m[0][1] == s);
+    }
+}
@@ -0,0 +1,162 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+const size_t VERTICES = 1001;
+const size_t BONES = 40;
+const size_t BEGIN = 13, END = VERTICES - 6;
+const vec3 UNTOUCHED(1234, 1234, 1234);
+
+// Interleaved, so the byte strides are not sizeof(vec3)
+template<class T>
+struct vertex_t {
+    vec3_t<T> position;
+    vec3_t<T> normal;
+    T uv[2];
+};
+
+struct scene {
+    std::vector<vertex_t<float>> vertices;
+    std::vector<vertex_t<double>> verticesd;
+    std::vector<unsigned char> bones;
+    std::vector<float> weights;
+    std::vector<double> weightsd;
+    std::vector<quat> rotations;
+    std::vector<vec3> translations;
+};
+
+scene make_scene() {
+    scene s;
+    s.vertices.resize(VERTICES);
+    s.verticesd.resize(VERTICES);
+    s.bones.resize(VERTICES * 4);
+    s.weights.resize(VERTICES * 4);
+    s.weightsd.resize(VERTICES * 4);
+
+    // Bones within a radian of the rest pose, as in a skeleton. Blending
+    // rotations far apart shrinks normals before they are renormalized,
+    // which costs linear blend skinning precision the bounds don't allow for.
+    for (size_t i = 0; i < BONES; ++i) {
+        auto axis = normalize(vec3(test_rnd<float>(), test_rnd<float>(), test_rnd<float>()));
+        s.rotations.push_back(quat::rotation_axis(axis, test_rnd<float>(-1, 1)));
+        s.translations.push_back(vec3(test_rnd<float>(-5, 5), test_rnd<float>(-5, 5), test_rnd<float>(-5, 5)));
+    }
+
+    for (size_t i = 0; i < VERTICES; ++i) {
+        auto& v = s.vertices[i];
+        v.position = vec3(test_rnd<float>(-2, 2), test_rnd<float>(-2, 2), test_rnd<float>(-2, 2));
+        v.normal = normalize(vec3(test_rnd<float>(), test_rnd<float>(), test_rnd<float>()));
+        s.verticesd[i].position = vec3d(v.position);
+        s.verticesd[i].normal = vec3d(v.normal);
+
+        // One to four bones, the unused slots weighted 0
+        auto used = 1 + i % 4;
+        float sum = 0;
+        for (size_t k = 0; k < 4; ++k) {
+            s.bones[i * 4 + k] = (unsigned char)(test_rnd<float>(0, 1) * (BONES - 1));
+            s.weights[i * 4 + k] = (k < used) ? test_rnd<float>(0.1f, 1) : 0;
+            sum += s.weights[i * 4 + k];
+        }
+        for (size_t k = 0; k < 4; ++k) {
+            s.weights[i * 4 + k] /= sum;
+            s.weightsd[i * 4 + k] = s.weights[i * 4 + k];
+        }
+    }
+
+    return s;
+}
+
+// Runs the float skinning (SIMD where available) and the double one (the
+// generic code) over [BEGIN, END) of the same scene, with and without normals
+template<class Palette, class Paletted>
+void check_skinning(const scene& s, const std::vector<Palette>& palette, const std::vector<Paletted>& paletted) {
+    const size_t stride = sizeof(vertex_t<float>), strided = sizeof(vertex_t<double>);
+    std::vector<vertex_t<float>> out(VERTICES), outPositions(VERTICES), outUnused(VERTICES);
+    std::vector<vertex_t<double>> outd(VERTICES);
+
+    for (size_t i = 0; i < VERTICES; ++i) {
+        out[i].position = out[i].normal = UNTOUCHED;
+        outPositions[i] = outUnused[i] = out[i];
+    }
+
+    skin_vertices(&out[0].position, &out[0].normal, stride, &s.vertices[0].position, &s.vertices[0].normal, stride,
+                  s.bones.data(), s.weights.data(), palette.data(), BEGIN, END);
+    skin_vertices(&outd[0].position, &outd[0].normal, strided, &s.verticesd[0].position, &s.verticesd[0].normal,
+                  strided, s.bones.data(), s.weightsd.data(), paletted.data(), BEGIN, END);
+
+    // Without input or output normals only positions are written
+    skin_vertices(&outPositions[0].position, (vec3*)nullptr, stride, &s.vertices[0].position, (const vec3*)nullptr,
+                  stride, s.bones.data(), s.weights.data(), palette.data(), BEGIN, END);
+    skin_vertices(&outUnused[0].position, &outUnused[0].normal, stride, &s.vertices[0].position, (const vec3*)nullptr,
+                  stride, s.bones.data(), s.weights.data(), palette.data(), BEGIN, END);
+
+    double position = 0, normal = 0;
+
+    for (size_t i = 0; i < VERTICES; ++i) {
+        auto inside = i >= BEGIN && i < END;
+        CHECK(inside == (out[i].position != UNTOUCHED));
+        CHECK(inside == (out[i].normal != UNTOUCHED));
+        CHECK(outPositions[i].position == out[i].position && outPositions[i].normal == UNTOUCHED);
+        CHECK(outUnused[i].position == out[i].position && outUnused[i].normal == UNTOUCHED);
+
+        if (inside) {
+            for (int k = 0; k < 3; ++k) {
+                position = std::max(position, fabs(out[i].position[k] - outd[i].position[k]));
+                normal = std::max(normal, fabs(out[i].normal[k] - outd[i].normal[k]));
+            }
+        }
+    }
+
+    // Positions are up to about 12 from the origin
+    CHECK_LE(position, 1e-5);
+    CHECK_LE(normal, 1e-6);
+}
+
+} // namespace
+
+TEST(skin_vertices_range) {
+    auto s = make_scene();
+    std::vector<mat4x3> palette;
+    std::vector<mat4x3d> paletted;
+
+    for (size_t i = 0; i < BONES; ++i) {
+        palette.push_back(mat4x3(s.rotations[i], s.translations[i]));
+        paletted.push_back(mat4x3d(palette.back()));
+    }
+
+    check_skinning(s, palette, paletted);
+}
+
+TEST(skin_vertices_dualquat_range) {
+    auto s = make_scene();
+    std::vector<dualquat> palette;
+    std::vector<dualquatd> paletted;
+
+    for (size_t i = 0; i < BONES; ++i) {
+        palette.push_back(dualquat(s.rotations[i], s.translations[i]));
+        paletted.push_back(dualquatd(quatd(palette.back().real), quatd(palette.back().dual)));
+    }
+
+    check_skinning(s, palette, paletted);
+}
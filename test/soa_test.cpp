@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+const size_t COUNT = 1027;
+
+quat random_rotation() {
+    auto axis = normalize(vec3(test_rnd<float>(-1, 1), test_rnd<float>(-1, 1), test_rnd<float>(-1, 1)));
+    return quat::rotation_axis(axis, test_rnd<float>(-3, 3));
+}
+
+double max_difference(const quat& a, const quat& b) {
+    return std::max(std::max(fabs(a.x - b.x), fabs(a.y - b.y)), std::max(fabs(a.z - b.z), fabs(a.w - b.w)));
+}
+
+// q and -q are the same rotation; slerp returns to unchanged at scale 1
+double rotation_difference(const quat& a, const quat& b) {
+    return std::min(max_difference(a, b), max_difference(a, -b));
+}
+
+} // namespace
+
+// The SIMD lanes and the scalar tail must both follow quat_t::slerp_fast,
+// including pairs on opposite hemispheres
+TEST(soa_slerp_fast_matches_quat) {
+    std::vector<quat> from(COUNT), to(COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+        from[i] = random_rotation();
+        to[i] = random_rotation();
+    }
+
+    quat_soa_t<float> a, b, out, exact;
+    to_soa(from.data(), COUNT, a);
+    to_soa(to.data(), COUNT, b);
+
+    const float scales[] = { 0.0f, 0.3f, 0.5f, 1.0f };
+    for (auto scale : scales) {
+        slerp_fast(a, b, scale, out);
+        slerp(a, b, scale, exact);
+
+        double fastMax = 0, exactMax = 0;
+        for (size_t i = 0; i < COUNT; ++i) {
+            fastMax = std::max(fastMax, max_difference(out.get(i), quat::slerp_fast(from[i], to[i], scale)));
+            exactMax = std::max(exactMax, rotation_difference(out.get(i), exact.get(i)));
+        }
+        CHECK_LE(fastMax, 1e-6);
+        CHECK_LE(exactMax, 3e-5);
+    }
+}
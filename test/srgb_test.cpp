@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+const size_t COUNT = (1 << 20) + 3; // evenly spaced over [0, 1], plus a scalar tail
+
+std::vector<float> ramp() {
+    std::vector<float> v(COUNT);
+    for (size_t i = 0; i < COUNT; ++i) {
+        v[i] = float(double(i) / (COUNT - 1));
+    }
+    return v;
+}
+
+double decode_error(float fast, float c) {
+    auto ref = srgb_to_linear(double(c));
+    return (ref > 0) ? fabs(fast - ref) / ref : fabs(fast);
+}
+
+double encode_error(float fast, float c) {
+    return fabs(fast - linear_to_srgb(double(c)));
+}
+
+} // namespace
+
+// The bounds in the srgb.h comment: relative 2e-6 decoding, absolute 3e-6 encoding
+TEST(srgb_fast_scalar_error) {
+    auto c = ramp();
+    double dec = 0, enc = 0;
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        dec = std::max(dec, decode_error(srgb_to_linear_fast(c[i]), c[i]));
+        enc = std::max(enc, encode_error(linear_to_srgb_fast(c[i]), c[i]));
+    }
+
+    CHECK_LE(dec, 2e-6);
+    CHECK_LE(enc, 3e-6);
+}
+
+// The float row converters run on SIMD
+TEST(srgb_fast_row_error) {
+    auto c = ramp();
+    std::vector<float> dec(COUNT), enc(COUNT);
+    srgb_to_linear_fast(dec.data(), c.data(), COUNT);
+    linear_to_srgb_fast(enc.data(), c.data(), COUNT);
+    double maxDec = 0, maxEnc = 0;
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        maxDec = std::max(maxDec, decode_error(dec[i], c[i]));
+        maxEnc = std::max(maxEnc, encode_error(enc[i], c[i]));
+    }
+
+    CHECK_LE(maxDec, 2e-6);
+    CHECK_LE(maxEnc, 3e-6);
+
+    // color4 rows convert r, g and b and pass alpha through
+    const size_t pixels = 1023;
+    std::vector<color4> px(pixels), dec4(pixels), enc4(pixels);
+    for (size_t i = 0; i < pixels; ++i) {
+        px[i] = color4(c[i * 1024], c[i * 1024 + 1], c[i * 1024 + 2], c[i * 1024 + 3]);
+    }
+    srgb_to_linear_fast(dec4.data(), px.data(), pixels);
+    linear_to_srgb_fast(enc4.data(), px.data(), pixels);
+
+    for (size_t i = 0; i < pixels; ++i) {
+        CHECK_LE(decode_error(dec4[i].r, px[i].r), 2e-6);
+        CHECK_LE(decode_error(dec4[i].b, px[i].b), 2e-6);
+        CHECK_LE(encode_error(enc4[i].g, px[i].g), 3e-6);
+        CHECK(dec4[i].a == px[i].a && enc4[i].a == px[i].a);
+    }
+}
+
+// Every code decodes and re-encodes to itself, and encoding only misses the
+// exact rounding on ties, by one code
+TEST(srgb8_round_trip) {
+    unsigned char codes[256], back[256], rgba[256];
+    float lin[256];
+    std::vector<color4> lin4(64);
+
+    for (int i = 0; i < 256; ++i) {
+        codes[i] = (unsigned char)i;
+        CHECK(linear_to_srgb8(srgb8_to_linear<float>(codes[i])) == codes[i]);
+    }
+
+    srgb8_to_linear(lin, codes, 256);
+    linear_to_srgb8(back, lin, 256);
+    srgba8_to_linear(lin4.data(), codes, 64);
+    linear_to_srgba8(rgba, lin4.data(), 64);
+    CHECK(memcmp(back, codes, 256) == 0);
+    CHECK(memcmp(rgba, codes, 256) == 0);
+
+    auto c = ramp();
+    std::vector<unsigned char> row(COUNT);
+    linear_to_srgb8(row.data(), c.data(), COUNT);
+    size_t misses = 0;
+
+    for (size_t i = 0; i < COUNT; ++i) {
+        auto exact = (int)(linear_to_srgb(double(c[i])) * 255 + 0.5);
+        auto scalar = (int)linear_to_srgb8(c[i]);
+        CHECK(abs(scalar - exact) <= 1 && abs(row[i] - exact) <= 1);
+        misses += (scalar != exact) + (row[i] != exact);
+    }
+
+    CHECK_LE(misses, COUNT / 1000);
+}
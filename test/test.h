@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+#include "zmath/zmath.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+// Minimal test harness: TEST(name) registers a case, CHECK records a failure
+// without stopping the case. zmath_test [--filter=<substring>] runs them all.
+
+struct test_case {
+    std::string name;
+    std::function<void()> run;
+};
+
+inline std::vector<test_case>& test_registry() {
+    static std::vector<test_case> cases;
+    return cases;
+}
+
+inline int& test_failures() {
+    static int failures;
+    return failures;
+}
+
+struct test_registrar {
+    test_registrar(const char* name, std::function<void()> run) {
+        test_registry().push_back(test_case{name, run});
+    }
+};
+
+#define TEST(name) \
+    static void test_##name(); \
+    static test_registrar test_registrar_##name(#name, test_##name); \
+    static void test_##name()
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            ++test_failures(); \
+        } \
+    } while (0)
+
+// Like CHECK, with the two values printed on failure
+#define CHECK_LE(a, b) \
+    do { \
+        double va = (a), vb = (b); \
+        if (!(va <= vb)) { \
+            fprintf(stderr, "%s:%d: CHECK_LE(%s, %s) failed: %.9g > %.9g\n", __FILE__, __LINE__, #a, #b, va, vb); \
+            ++test_failures(); \
+        } \
+    } while (0)
+
+inline std::mt19937& test_rng() {
+    static std::mt19937 rng(42);
+    return rng;
+}
+
+template<class T>
+T test_rnd(T min = -1, T max = 1) {
+    return std::uniform_real_distribution<T>(min, max)(test_rng());
+}
+
+// Distance in representable floats; both signs of zero are the same value
+inline int64_t ulp_distance(float a, float b) {
+    int32_t ia, ib;
+    memcpy(&ia, &a, sizeof(a));
+    memcpy(&ib, &b, sizeof(b));
+    int64_t la = (ia < 0) ? -(int64_t)(ia & 0x7fffffff) : ia;
+    int64_t lb = (ib < 0) ? -(int64_t)(ib & 0x7fffffff) : ib;
+    return (la > lb) ? la - lb : lb - la;
+}
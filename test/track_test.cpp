@@ -0,0 +1,316 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#include "test.h"
+
+namespace {
+
+const float TIMES[] = { 0, 1, 3, 4 };
+const vec3 POINTS[] = { vec3(0, 0, 0), vec3(1, 2, -1), vec3(4, -2, 3), vec3(5, 0, 0) };
+const vec3 TANGENTS[] = { vec3(1, 0, 0), vec3(0, 1, 0), vec3(-1, 2, 0.5f), vec3(0, 0, -1) };
+
+vec3_track make_vec3_track(track_interp interp) {
+    vec3_track track;
+    track.times.assign(TIMES, TIMES + 4);
+    track.values.assign(POINTS, POINTS + 4);
+    track.tangents.assign(TANGENTS, TANGENTS + 4);
+    track.interp = interp;
+    return track;
+}
+
+// Rotations about one axis, so the expected samples are rotations by
+// interpolated angles
+const float ANGLES[] = { 0, 1, 2.5f, -0.5f };
+const vec3 AXIS(0.6f, 0, 0.8f);
+
+quat_track make_quat_track(track_interp interp) {
+    quat_track track;
+    track.times.assign(TIMES, TIMES + 4);
+    for (auto a : ANGLES) {
+        track.values.push_back(quat::rotation_axis(AXIS, a));
+    }
+    track.interp = interp;
+    return track;
+}
+
+double distance(const vec3& a, const vec3d& b) {
+    return std::max(std::max(fabs(a.x - b.x), fabs(a.y - b.y)), fabs(a.z - b.z));
+}
+
+// Rotation angle between two quaternions, either sign. From the relative
+// rotation with atan2, which unlike acos of the dot product is not thrown
+// off by lengths slightly off one.
+double angle_between(const quat& a, const quat& b) {
+    auto r = !quatd(a) * quatd(b);
+    return 2 * atan2(sqrt(r.x * r.x + r.y * r.y + r.z * r.z), fabs(r.w));
+}
+
+double angle_between(const quat& a, float angle) {
+    return angle_between(a, quat::rotation_axis(AXIS, angle));
+}
+
+vec3d hermite(const vec3& p0, const vec3d& m0, const vec3& p1, const vec3d& m1, double u) {
+    return vec3d(p0) * (2 * u * u * u - 3 * u * u + 1) + m0 * (u * u * u - 2 * u * u + u) +
+           vec3d(p1) * (3 * u * u - 2 * u * u * u) + m1 * (u * u * u - u * u);
+}
+
+size_t reference_segment(const float* times, size_t count, float time) {
+    auto i = std::upper_bound(times, times + count, time) - times - 1;
+    return (i < 0) ? 0 : std::min(size_t(i), count - 2);
+}
+
+} // namespace
+
+// The cursor gives the same segment as a binary search whichever way time
+// moves: forward in small steps, backwards, far ahead and past either end
+TEST(track_find_cursor) {
+    std::vector<float> times;
+    for (int i = 0; i < 40; ++i) {
+        times.push_back(i * 0.5f + ((i % 3) ? 0.25f : 0));
+    }
+
+    const float sequence[] = { -1, 0, 0.1f, 0.5f, 0.75f, 1, 1.3f, 0.2f, 12, 12.1f, 11.9f, 3, 100, 19.75f, 19.5f, -3, 7 };
+    track_cursor_t cursor;
+
+    for (auto t : sequence) {
+        auto i = track_find(times.data(), times.size(), t, cursor);
+        CHECK(i == reference_segment(times.data(), times.size(), t));
+        CHECK(cursor.key == i);
+    }
+
+    for (int k = 0; k < 2000; ++k) {
+        auto t = test_rnd<float>(-2, 22);
+        CHECK(track_find(times.data(), times.size(), t, cursor) == reference_segment(times.data(), times.size(), t));
+    }
+
+    CHECK(track_factor(TIMES, 1, 1.0f) == 0);
+    CHECK(track_factor(TIMES, 1, 2.0f) == 0.5f);
+    CHECK(track_factor(TIMES, 0, -4.0f) == 0);
+    CHECK(track_factor(TIMES, 2, 9.0f) == 1);
+}
+
+// Every mode passes through the keys and clamps outside them
+TEST(vec3_track_keys) {
+    const track_interp modes[] = { TRACK_STEP, TRACK_LINEAR, TRACK_HERMITE, TRACK_CATMULL_ROM };
+
+    for (auto mode : modes) {
+        auto track = make_vec3_track(mode);
+        track_cursor_t cursor;
+
+        for (int i = 0; i < 4; ++i) {
+            CHECK_LE(distance(track.sample(TIMES[i], cursor), vec3d(POINTS[i])), 1e-6);
+        }
+
+        CHECK(track.sample(-2.0f, cursor) == POINTS[0]);
+        CHECK(track.sample(9.0f, cursor) == POINTS[3]);
+    }
+
+    vec3_track single;
+    single.times.push_back(2);
+    single.values.push_back(POINTS[2]);
+    track_cursor_t cursor;
+    CHECK(single.sample(0.0f, cursor) == POINTS[2] && single.sample(5.0f, cursor) == POINTS[2]);
+}
+
+TEST(vec3_track_midpoints) {
+    track_cursor_t cursor;
+
+    auto step = make_vec3_track(TRACK_STEP);
+    CHECK(step.sample(0.5f, cursor) == POINTS[0] && step.sample(2.0f, cursor) == POINTS[1]);
+    CHECK(step.sample(3.999f, cursor) == POINTS[2]);
+
+    auto linear = make_vec3_track(TRACK_LINEAR);
+    CHECK_LE(distance(linear.sample(2.0f, cursor), (vec3d(POINTS[1]) + vec3d(POINTS[2])) * 0.5), 1e-6);
+    CHECK_LE(distance(linear.sample(3.25f, cursor), vec3d(POINTS[2]) * 0.75 + vec3d(POINTS[3]) * 0.25), 1e-6);
+
+    // Tangents are per unit time, scaled by the segment length of 2
+    auto hermite_track = make_vec3_track(TRACK_HERMITE);
+    auto expected = hermite(POINTS[1], vec3d(TANGENTS[1]) * 2.0, POINTS[2], vec3d(TANGENTS[2]) * 2.0, 0.25);
+    CHECK_LE(distance(hermite_track.sample(1.5f, cursor), expected), 1e-5);
+
+    // The tangent is the derivative at the key
+    const float h = 1e-3f;
+    auto slope = (vec3d(hermite_track.sample(3 + h, cursor)) - vec3d(hermite_track.sample(3 - h, cursor))) / (2.0 * h);
+    CHECK_LE(distance(TANGENTS[2], slope), 1e-2);
+
+    // Catmull-Rom tangents from the neighbouring keys, one-sided at the ends
+    auto catmull = make_vec3_track(TRACK_CATMULL_ROM);
+    auto m1 = (vec3d(POINTS[2]) - vec3d(POINTS[0])) * (2.0 / 3.0);
+    auto m2 = (vec3d(POINTS[3]) - vec3d(POINTS[1])) * (2.0 / 3.0);
+    CHECK_LE(distance(catmull.sample(2.0f, cursor), hermite(POINTS[1], m1, POINTS[2], m2, 0.5)), 1e-5);
+
+    auto first = vec3d(POINTS[1]) - vec3d(POINTS[0]);
+    auto m1First = (vec3d(POINTS[2]) - vec3d(POINTS[0])) * (1.0 / 3.0);
+    CHECK_LE(distance(catmull.sample(0.5f, cursor), hermite(POINTS[0], first, POINTS[1], m1First, 0.5)), 1e-5);
+
+    auto last = vec3d(POINTS[3]) - vec3d(POINTS[2]);
+    auto m2Last = (vec3d(POINTS[3]) - vec3d(POINTS[1])) * (1.0 / 3.0);
+    CHECK_LE(distance(catmull.sample(3.5f, cursor), hermite(POINTS[2], m2Last, POINTS[3], last, 0.5)), 1e-5);
+}
+
+// 16 bits per component: within half a step of range / 65535, and constant
+// components stay exact
+TEST(vec3_track_quantized) {
+    vec3_track track;
+    for (int i = 0; i < 100; ++i) {
+        track.times.push_back(float(i));
+        track.values.push_back(vec3(test_rnd<float>(-50, 50), 7.5f, test_rnd<float>(0, 1)));
+    }
+
+    auto original = track;
+    track.quantize();
+    CHECK(track.quantized() && track.values.empty());
+
+    double error[3] = {};
+    for (size_t i = 0; i < track.size(); ++i) {
+        auto k = track.key(i);
+        auto v = original.values[i];
+        for (int c = 0; c < 3; ++c) {
+            error[c] = std::max(error[c], fabs(double(k[c]) - v[c]));
+        }
+    }
+
+    for (int c = 0; c < 3; ++c) {
+        CHECK_LE(error[c], 0.5 * track.range[c] / 65535 + 1e-5);
+    }
+    CHECK(error[1] == 0);
+
+    // Sampling interpolates the dequantized keys
+    track_cursor_t cursor, originalCursor;
+    for (int i = 0; i < 500; ++i) {
+        auto t = test_rnd<float>(-1, 100);
+        CHECK_LE(distance(track.sample(t, cursor), vec3d(original.sample(t, originalCursor))), 2e-3);
+    }
+}
+
+TEST(quat_track_modes) {
+    track_cursor_t cursor;
+
+    for (auto mode : { TRACK_STEP, TRACK_LINEAR, TRACK_SLERP }) {
+        auto track = make_quat_track(mode);
+
+        for (int i = 0; i < 4; ++i) {
+            CHECK_LE(angle_between(track.sample(TIMES[i], cursor), ANGLES[i]), 1e-4);
+        }
+
+        CHECK_LE(angle_between(track.sample(-1.0f, cursor), ANGLES[0]), 1e-4);
+        CHECK_LE(angle_between(track.sample(6.0f, cursor), ANGLES[3]), 1e-4);
+
+        // Exact for all three at the middle of a segment, nlerp only there
+        auto mid = track.sample(2.0f, cursor);
+        CHECK_LE(angle_between(mid, (mode == TRACK_STEP) ? ANGLES[1] : (ANGLES[1] + ANGLES[2]) / 2), 1e-4);
+    }
+
+    // Slerp keeps constant angular velocity, nlerp does not
+    auto slerp = make_quat_track(TRACK_SLERP);
+    auto nlerp = make_quat_track(TRACK_LINEAR);
+    auto quarter = ANGLES[2] * 0.75f + ANGLES[3] * 0.25f;
+    CHECK_LE(angle_between(slerp.sample(3.25f, cursor), quarter), 1e-4);
+    CHECK(angle_between(nlerp.sample(3.25f, cursor), quarter) > 1e-3);
+
+    // Keys stored with the opposite sign still take the shorter arc
+    slerp.values[2] = -slerp.values[2];
+    CHECK_LE(angle_between(slerp.sample(2.0f, cursor), (ANGLES[1] + ANGLES[2]) / 2), 1e-4);
+}
+
+// quat48 components are off by up to 6.5e-5, see quatpack.h, which bounds
+// the rotation error of keys and samples by about 2e-4 radians
+TEST(quat_track_quantized) {
+    quat_track track;
+    for (int i = 0; i < 100; ++i) {
+        track.times.push_back(i * 0.1f);
+        track.values.push_back(normalize(quat(test_rnd<float>(), test_rnd<float>(), test_rnd<float>(), test_rnd<float>())));
+    }
+
+    auto original = track;
+    track.quantize();
+    CHECK(track.quantized() && track.values.empty());
+
+    double keyError = 0, sampleError = 0;
+    for (size_t i = 0; i < track.size(); ++i) {
+        keyError = std::max(keyError, angle_between(track.key(i), original.values[i]));
+    }
+
+    track_cursor_t cursor, originalCursor;
+    for (int i = 0; i < 500; ++i) {
+        auto t = test_rnd<float>(-1, 11);
+        sampleError = std::max(sampleError, angle_between(track.sample(t, cursor), original.sample(t, originalCursor)));
+    }
+
+    CHECK_LE(keyError, 2e-4);
+    CHECK_LE(sampleError, 2e-4);
+}
+
+// Whole poses match sampling every track on its own, through empty, single
+// key, quantized and every interpolation mode, with time running forwards,
+// backwards and jumping
+TEST(pose_sampler_matches_tracks) {
+    const size_t bones = 7;
+    anim_clip clip(bones);
+
+    clip.translations[1] = make_vec3_track(TRACK_LINEAR);
+    clip.translations[2] = make_vec3_track(TRACK_CATMULL_ROM);
+    clip.translations[4] = make_vec3_track(TRACK_HERMITE);
+    clip.translations[4].quantize();
+    clip.scales[2] = make_vec3_track(TRACK_STEP);
+    clip.scales[5].times.push_back(1);
+    clip.scales[5].values.push_back(vec3(2, 2, 2));
+
+    clip.rotations[1] = make_quat_track(TRACK_SLERP);
+    clip.rotations[2] = make_quat_track(TRACK_LINEAR);
+    clip.rotations[3] = make_quat_track(TRACK_STEP);
+    clip.rotations[4] = make_quat_track(TRACK_SLERP);
+    clip.rotations[4].quantize();
+    clip.rotations[5] = make_quat_track(TRACK_LINEAR);
+    clip.rotations[5].quantize();
+    clip.rotations[6].times.push_back(0);
+    clip.rotations[6].values.push_back(quat::rotation_axis(AXIS, 1));
+
+    pose_sampler sampler(bones);
+    std::vector<vec3> translations(bones), scales(bones);
+    std::vector<quat> rotations(bones), rotationsOnly(bones);
+    const float sequence[] = { 0, 0.1f, 0.2f, 0.35f, 1, 2.5f, 2.4f, 0.5f, -1, 3.9f, 4, 8, 1.5f, 1.6f };
+
+    for (auto t : sequence) {
+        sampler.sample(clip, t, translations.data(), rotations.data(), scales.data());
+
+        for (size_t b = 0; b < bones; ++b) {
+            track_cursor_t cursor;
+            auto& tt = clip.translations[b];
+            auto& rt = clip.rotations[b];
+            auto& st = clip.scales[b];
+            CHECK(translations[b] == (tt.times.empty() ? vec3(0, 0, 0) : tt.sample(t, cursor)));
+            CHECK(scales[b] == (st.times.empty() ? vec3(1, 1, 1) : st.sample(t, cursor)));
+            auto expected = rt.times.empty() ? quat() : rt.sample(t, cursor);
+            CHECK_LE(angle_between(rotations[b], expected), 1e-6);
+            CHECK_LE(fabs(dot(rotations[b], rotations[b]) - 1), 1e-4);
+        }
+    }
+
+    // Skipped channels are not written
+    sampler.reset();
+    std::vector<vec3> untouched(bones, vec3(9, 9, 9));
+    sampler.sample(clip, 2.0f, nullptr, rotationsOnly.data(), nullptr);
+    sampler.sample(clip, 2.0f, untouched.data(), nullptr, nullptr);
+    sampler.sample(clip, 2.0f, translations.data(), rotations.data(), scales.data());
+    CHECK(memcmp(rotationsOnly.data(), rotations.data(), bones * sizeof(quat)) == 0);
+    CHECK(memcmp(untouched.data(), translations.data(), bones * sizeof(vec3)) == 0);
+}
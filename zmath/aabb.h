@@ -0,0 +1,218 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+template<class T>
+struct aabb_t {
+    vec3_t<T> min;
+    vec3_t<T> max;
+
+    aabb_t() {}
+    aabb_t(const vec3_t<T>& min, const vec3_t<T>& max) : min(min), max(max) {}
+    explicit aabb_t(const vec3_t<T>& p) : min(p), max(p) {}
+    template<class U>
+    explicit aabb_t(const aabb_t<U>& b) : min(b.min), max(b.max) {}
+
+    // Arvo's method: every output axis is the translation plus, per input axis,
+    // the smaller and larger of the two scaled extremes. The matrix is assumed
+    // to be affine.
+    aabb_t operator * (const mat4x4_t<T>& m) const {
+        if (is_empty()) {
+            return *this;
+        }
+
+        aabb_t r(vec3_t<T>(m.m41, m.m42, m.m43));
+
+        for (int j = 0; j < 3; ++j) {
+            for (int i = 0; i < 3; ++i) {
+                auto a = m.m[j][i] * min[j];
+                auto b = m.m[j][i] * max[j];
+
+                if (a < b) {
+                    r.min[i] += a;
+                    r.max[i] += b;
+                } else {
+                    r.min[i] += b;
+                    r.max[i] += a;
+                }
+            }
+        }
+
+        return r;
+    }
+
+    aabb_t& operator *= (const mat4x4_t<T>& m) {
+        return *this = *this * m;
+    }
+
+    bool operator == (const aabb_t& b) const {
+        return min == b.min && max == b.max;
+    }
+
+    bool operator != (const aabb_t& b) const {
+        return min != b.min || max != b.max;
+    }
+
+    vec3_t<T> center() const {
+        return (min + max) * T(0.5);
+    }
+
+    // Half the size along each axis
+    vec3_t<T> extents() const {
+        return (max - min) * T(0.5);
+    }
+
+    vec3_t<T> size() const {
+        return max - min;
+    }
+
+    T surface_area() const {
+        auto d = max - min;
+        return 2 * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+
+    bool is_empty() const {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+    }
+
+    bool contains(const vec3_t<T>& p) const {
+        return p.x >= min.x && p.x <= max.x &&
+               p.y >= min.y && p.y <= max.y &&
+               p.z >= min.z && p.z <= max.z;
+    }
+
+    bool contains(const aabb_t& b) const {
+        return b.min.x >= min.x && b.max.x <= max.x &&
+               b.min.y >= min.y && b.max.y <= max.y &&
+               b.min.z >= min.z && b.max.z <= max.z;
+    }
+
+    bool intersects(const aabb_t& b) const {
+        return b.min.x <= max.x && b.max.x >= min.x &&
+               b.min.y <= max.y && b.max.y >= min.y &&
+               b.min.z <= max.z && b.max.z >= min.z;
+    }
+
+    // Inverted box that merges into anything without changing it
+    static aabb_t empty() {
+        auto m = std::numeric_limits<T>::max();
+        return aabb_t(vec3_t<T>(m, m, m), vec3_t<T>(-m, -m, -m));
+    }
+};
+
+template<class T>
+aabb_t<T> merge(const aabb_t<T>& a, const aabb_t<T>& b) {
+    return aabb_t<T>(minimize(a.min, b.min), maximize(a.max, b.max));
+}
+
+template<class T>
+aabb_t<T> merge(const aabb_t<T>& a, const vec3_t<T>& p) {
+    return aabb_t<T>(minimize(a.min, p), maximize(a.max, p));
+}
+
+// Bounds of a point array; empty() for count == 0
+template<class T>
+aabb_t<T> compute_bounds(const vec3_t<T>* points, size_t count) {
+    auto r = aabb_t<T>::empty();
+
+    for (size_t i = 0; i < count; ++i) {
+        r.min = minimize(r.min, points[i]);
+        r.max = maximize(r.max, points[i]);
+    }
+
+    return r;
+}
+
+#if defined(ZMATH_SIMD)
+template<>
+inline aabb_t<float> aabb_t<float>::operator * (const mat4x4_t<float>& m) const {
+    if (is_empty()) {
+        return *this;
+    }
+
+    auto lo = simd_load(m.m[3]);
+    auto hi = lo;
+
+    for (int j = 0; j < 3; ++j) {
+        auto row = simd_load(m.m[j]);
+        auto a = simd_mul(row, simd_splat(min[j]));
+        auto b = simd_mul(row, simd_splat(max[j]));
+        lo = simd_add(lo, simd_min(a, b));
+        hi = simd_add(hi, simd_max(a, b));
+    }
+
+    aabb_t<float> r;
+    simd_store3(&r.min.x, lo);
+    simd_store3(&r.max.x, hi);
+    return r;
+}
+
+template<>
+inline aabb_t<float>& aabb_t<float>::operator *= (const mat4x4_t<float>& m) {
+    return *this = *this * m;
+}
+
+// Four packed points are three registers (xyzx, yzxy, zxyz), so the running
+// minimum and maximum are kept in that layout and only folded at the end.
+template<>
+inline aabb_t<float> compute_bounds(const vec3_t<float>* points, size_t count) {
+    auto r = aabb_t<float>::empty();
+    auto blocks = count / 4;
+
+    if (blocks > 0) {
+        simd4f lo[3], hi[3];
+        auto p = &points->x;
+
+        for (int k = 0; k < 3; ++k) {
+            lo[k] = simd_splat(r.min.x);
+            hi[k] = simd_splat(r.max.x);
+        }
+
+        for (size_t i = 0; i < blocks; ++i, p += 12) {
+            for (int k = 0; k < 3; ++k) {
+                auto v = simd_load(p + k * 4);
+                lo[k] = simd_min(lo[k], v);
+                hi[k] = simd_max(hi[k], v);
+            }
+        }
+
+        float a[12], b[12];
+
+        for (int k = 0; k < 3; ++k) {
+            simd_store(a + k * 4, lo[k]);
+            simd_store(b + k * 4, hi[k]);
+        }
+
+        for (int k = 0; k < 4; ++k) {
+            r.min = minimize(r.min, vec3_t<float>(a[k * 3], a[k * 3 + 1], a[k * 3 + 2]));
+            r.max = maximize(r.max, vec3_t<float>(b[k * 3], b[k * 3 + 1], b[k * 3 + 2]));
+        }
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        r.min = minimize(r.min, points[i]);
+        r.max = maximize(r.max, points[i]);
+    }
+
+    return r;
+}
+#endif
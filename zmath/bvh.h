@@ -0,0 +1,373 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#if defined(ZMATH_THREADS)
+#include <thread>
+#endif
+
+// Bounding volume hierarchy over a static triangle soup. Nodes are stored
+// depth-first in a flat array: the left child of an interior node directly
+// follows it, so only the right child needs an index.
+
+template<class T>
+struct bvh_node_t {
+    aabb_t<T> bounds;
+    unsigned int index;   // first triangle of a leaf, right child of an interior node
+    unsigned short count; // triangles in a leaf, 0 for interior nodes
+    unsigned short axis;  // split axis, used to visit the nearer child first
+};
+
+template<class T>
+struct bvh_hit_t {
+    T t;
+    T u, v; // barycentric weights of the second and third vertex
+    unsigned int triangle;
+};
+
+template<class T>
+struct bvh_t {
+    enum {
+        MAX_DEPTH = 64,
+        SAH_BINS = 16,
+    };
+
+    std::vector<bvh_node_t<T>> nodes;
+    std::vector<vec3_t<T>> vertices;     // triangles in leaf order, three vertices each
+    std::vector<unsigned int> triangles; // index of every leaf triangle in the input
+
+    bvh_t() {}
+
+    bvh_t(const vec3_t<T>* vertices, size_t count, size_t maxLeafSize = 4, unsigned threads = 1) {
+        build(vertices, count, maxLeafSize, threads);
+    }
+
+    // Binned SAH build over count triangles (3 * count vertices). With
+    // ZMATH_THREADS defined the top levels of the tree are built
+    // concurrently on up to threads threads, 0 meaning one per hardware
+    // thread; without it threads is ignored and the build is serial.
+    void build(const vec3_t<T>* verts, size_t count, size_t maxLeafSize = 4, unsigned threads = 1) {
+        assert(maxLeafSize > 0 && maxLeafSize <= 0xffff);
+        nodes.clear();
+        vertices.clear();
+        triangles.resize(count);
+
+        if (count == 0) {
+            return;
+        }
+
+        std::vector<aabb_t<T>> bounds(count);
+        std::vector<vec3_t<T>> centroids(count);
+
+        for (size_t i = 0; i < count; ++i) {
+            bounds[i] = merge(merge(aabb_t<T>(verts[i * 3]), verts[i * 3 + 1]), verts[i * 3 + 2]);
+            centroids[i] = bounds[i].center();
+            triangles[i] = (unsigned int)i;
+        }
+
+#if defined(ZMATH_THREADS)
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+#else
+        threads = 1;
+#endif
+
+        build_context ctx;
+        ctx.bounds = bounds.data();
+        ctx.centroids = centroids.data();
+        ctx.triangles = triangles.data();
+        ctx.maxLeafSize = maxLeafSize;
+        ctx.parallelDepth = 0;
+
+        while ((1u << ctx.parallelDepth) < threads) {
+            ++ctx.parallelDepth;
+        }
+
+        nodes.reserve(count * 2 / maxLeafSize + 1);
+        build_node(ctx, 0, count, 0, nodes);
+
+        vertices.resize(count * 3);
+
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t k = 0; k < 3; ++k) {
+                vertices[i * 3 + k] = verts[triangles[i] * 3 + k];
+            }
+        }
+    }
+
+    // Closest hit in [0, tMax)
+    bool intersect(const ray_t<T>& r, bvh_hit_t<T>& hit, T tMax = std::numeric_limits<T>::max()) const {
+        if (nodes.empty()) {
+            return false;
+        }
+
+        vec3_t<T> invDir(1 / r.dir.x, 1 / r.dir.y, 1 / r.dir.z);
+        unsigned int stack[MAX_DEPTH];
+        unsigned int i = 0;
+        int top = 0;
+        bool found = false;
+
+        for (;;) {
+            auto& node = nodes[i];
+            T tBox;
+
+            if (intersect_aabb(r.pos, invDir, node.bounds, tMax, tBox)) {
+                if (node.count == 0) {
+                    auto nearChild = i + 1;
+                    auto farChild = node.index;
+
+                    if (invDir[node.axis] < 0) {
+                        std::swap(nearChild, farChild);
+                    }
+
+                    stack[top++] = farChild;
+                    i = nearChild;
+                    continue;
+                }
+
+                for (auto k = node.index; k < node.index + node.count; ++k) {
+                    T t, u, v;
+
+                    if (intersect_triangle(r, vertices[k * 3], vertices[k * 3 + 1], vertices[k * 3 + 2], t, u, v) && t < tMax) {
+                        tMax = t;
+                        hit.t = t;
+                        hit.u = u;
+                        hit.v = v;
+                        hit.triangle = triangles[k];
+                        found = true;
+                    }
+                }
+            }
+
+            if (top == 0) {
+                return found;
+            }
+
+            i = stack[--top];
+        }
+    }
+
+    // Any hit in [0, tMax), e.g. for shadow rays
+    bool occluded(const ray_t<T>& r, T tMax = std::numeric_limits<T>::max()) const {
+        if (nodes.empty()) {
+            return false;
+        }
+
+        vec3_t<T> invDir(1 / r.dir.x, 1 / r.dir.y, 1 / r.dir.z);
+        unsigned int stack[MAX_DEPTH];
+        unsigned int i = 0;
+        int top = 0;
+
+        for (;;) {
+            auto& node = nodes[i];
+            T tBox;
+
+            if (intersect_aabb(r.pos, invDir, node.bounds, tMax, tBox)) {
+                if (node.count == 0) {
+                    stack[top++] = node.index;
+                    i = i + 1;
+                    continue;
+                }
+
+                for (auto k = node.index; k < node.index + node.count; ++k) {
+                    T t, u, v;
+
+                    if (intersect_triangle(r, vertices[k * 3], vertices[k * 3 + 1], vertices[k * 3 + 2], t, u, v) && t < tMax) {
+                        return true;
+                    }
+                }
+            }
+
+            if (top == 0) {
+                return false;
+            }
+
+            i = stack[--top];
+        }
+    }
+
+    struct build_context {
+        const aabb_t<T>* bounds;
+        const vec3_t<T>* centroids;
+        unsigned int* triangles;
+        size_t maxLeafSize;
+        int parallelDepth; // levels above this one build their subtrees concurrently
+    };
+
+    // Emits the subtree for triangles [begin, end) into out; interior node
+    // indices are relative to the start of out.
+    static void build_node(const build_context& ctx, size_t begin, size_t end, int depth, std::vector<bvh_node_t<T>>& out) {
+        auto tris = ctx.triangles;
+        auto count = end - begin;
+        auto self = out.size();
+        auto centroidBounds = aabb_t<T>::empty();
+
+        bvh_node_t<T> node;
+        node.bounds = aabb_t<T>::empty();
+        node.index = (unsigned int)begin;
+        node.count = 0;
+        node.axis = 0;
+
+        for (auto i = begin; i < end; ++i) {
+            node.bounds = merge(node.bounds, ctx.bounds[tris[i]]);
+            centroidBounds = merge(centroidBounds, ctx.centroids[tris[i]]);
+        }
+
+        out.push_back(node);
+
+        // Cost of a split relative to intersecting every triangle, in units of
+        // triangle tests times the parent surface area, with one traversal step
+        // costing as much as one triangle test
+        auto extent = centroidBounds.size();
+        auto area = node.bounds.surface_area();
+        auto bestCost = std::numeric_limits<T>::max();
+        auto bestAxis = -1;
+        auto bestBin = 0;
+
+        // Below half the depth budget only object-median splits are made, which
+        // bounds the depth of the tree by MAX_DEPTH
+        if (count > 1 && depth < MAX_DEPTH / 2) {
+            for (int a = 0; a < 3; ++a) {
+                if (!(extent[a] > 0)) {
+                    continue;
+                }
+
+                aabb_t<T> bins[SAH_BINS];
+                size_t binCounts[SAH_BINS] = {};
+                auto scale = SAH_BINS / extent[a];
+
+                for (int b = 0; b < SAH_BINS; ++b) {
+                    bins[b] = aabb_t<T>::empty();
+                }
+
+                for (auto i = begin; i < end; ++i) {
+                    auto b = bin(ctx.centroids[tris[i]][a], centroidBounds.min[a], scale);
+                    bins[b] = merge(bins[b], ctx.bounds[tris[i]]);
+                    ++binCounts[b];
+                }
+
+                T leftCosts[SAH_BINS];
+                auto acc = aabb_t<T>::empty();
+                size_t n = 0;
+
+                for (int b = 0; b < SAH_BINS - 1; ++b) {
+                    acc = merge(acc, bins[b]);
+                    n += binCounts[b];
+                    leftCosts[b] = n ? acc.surface_area() * T(n) : 0;
+                }
+
+                acc = aabb_t<T>::empty();
+                n = 0;
+
+                for (int b = SAH_BINS - 1; b > 0; --b) {
+                    acc = merge(acc, bins[b]);
+                    n += binCounts[b];
+
+                    if (n == 0 || n == count) {
+                        continue;
+                    }
+
+                    auto cost = leftCosts[b - 1] + acc.surface_area() * T(n);
+
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        bestAxis = a;
+                        bestBin = b;
+                    }
+                }
+            }
+        }
+
+        if (count <= ctx.maxLeafSize && (bestAxis < 0 || area * T(count) <= area + bestCost)) {
+            out[self].count = (unsigned short)count;
+            return;
+        }
+
+        size_t mid;
+
+        if (bestAxis >= 0) {
+            auto minimum = centroidBounds.min[bestAxis];
+            auto scale = SAH_BINS / extent[bestAxis];
+            mid = std::partition(tris + begin, tris + end, [&](unsigned int t) {
+                return bin(ctx.centroids[t][bestAxis], minimum, scale) < bestBin;
+            }) - tris;
+        } else {
+            bestAxis = 0;
+
+            if (extent[1] > extent[bestAxis]) {
+                bestAxis = 1;
+            }
+
+            if (extent[2] > extent[bestAxis]) {
+                bestAxis = 2;
+            }
+
+            mid = begin + count / 2;
+            std::nth_element(tris + begin, tris + mid, tris + end, [&](unsigned int a, unsigned int b) {
+                return ctx.centroids[a][bestAxis] < ctx.centroids[b][bestAxis];
+            });
+        }
+
+        out[self].axis = (unsigned short)bestAxis;
+
+#if defined(ZMATH_THREADS)
+        if (depth < ctx.parallelDepth && count >= 1024) {
+            std::vector<bvh_node_t<T>> left, right;
+            std::thread worker([&]() {
+                build_node(ctx, mid, end, depth + 1, right);
+            });
+            build_node(ctx, begin, mid, depth + 1, left);
+            worker.join();
+
+            append(out, left);
+            out[self].index = (unsigned int)out.size();
+            append(out, right);
+            return;
+        }
+#endif
+
+        build_node(ctx, begin, mid, depth + 1, out);
+        out[self].index = (unsigned int)out.size();
+        build_node(ctx, mid, end, depth + 1, out);
+    }
+
+    static int bin(T centroid, T minimum, T scale) {
+        auto b = int((centroid - minimum) * scale);
+        return (b < SAH_BINS - 1) ? b : SAH_BINS - 1;
+    }
+
+    static void append(std::vector<bvh_node_t<T>>& out, const std::vector<bvh_node_t<T>>& nodes) {
+        auto base = (unsigned int)out.size();
+
+        for (auto node : nodes) {
+            if (node.count == 0) {
+                node.index += base;
+            }
+
+            out.push_back(node);
+        }
+    }
+};
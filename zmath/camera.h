@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// Camera-relative rendering for large worlds. Transforms and the eye stay in
+// double (or any T) and the eye is subtracted before narrowing, so the float
+// results keep full precision near the camera. World matrices must be affine.
+template<class T>
+vec3_t<float> camera_relative(const vec3_t<T>& p, const vec3_t<T>& eye) {
+    return vec3_t<float>(p - eye);
+}
+
+template<class T>
+mat4x3_t<float> camera_relative(const mat4x3_t<T>& world, const vec3_t<T>& eye) {
+    auto m = world;
+    m.m41 -= eye.x;
+    m.m42 -= eye.y;
+    m.m43 -= eye.z;
+    return mat4x3_t<float>(m);
+}
+
+template<class T>
+mat4x4_t<float> camera_relative(const mat4x4_t<T>& world, const vec3_t<T>& eye) {
+    auto m = world;
+    m.m41 -= eye.x;
+    m.m42 -= eye.y;
+    m.m43 -= eye.z;
+    return mat4x4_t<float>(m);
+}
+
+// View matrix with the eye at the origin, e.g. from a double lookat; pairs
+// with the camera-relative world matrices of the same eye.
+template<class T>
+mat4x4_t<float> camera_relative_view(const mat4x4_t<T>& view) {
+    auto m = mat4x4_t<float>(view);
+    m.m41 = 0;
+    m.m42 = 0;
+    m.m43 = 0;
+    return m;
+}
+
+// World-view matrix in float from a double world transform
+template<class T>
+mat4x4_t<float> camera_relative(const mat4x4_t<T>& world, const vec3_t<T>& eye, const mat4x4_t<float>& view) {
+    return camera_relative(world, eye) * view;
+}
+
+template<class T>
+void camera_relative(mat4x4_t<float>* out, const mat4x4_t<T>* worlds, const vec3_t<T>& eye,
+                     const mat4x4_t<float>& view, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = camera_relative(worlds[i], eye) * view;
+    }
+}
+
+template<class T>
+void camera_relative(mat4x3_t<float>* out, const mat4x3_t<T>* worlds, const vec3_t<T>& eye, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = camera_relative(worlds[i], eye);
+    }
+}
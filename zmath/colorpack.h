@@ -0,0 +1,470 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+#include <cstring>
+
+// Packed color formats. Normalized channels are clamped to [0, 1] (NaN
+// becomes 0) and rounded to nearest. Channels are listed from the least
+// significant bits, so RGBA8 keeps R in the low byte, which is the R, G, B,
+// A byte order of DXGI_FORMAT_R8G8B8A8_UNORM on little-endian machines.
+
+template<int B, class T>
+unsigned int unorm_encode(T x) {
+    auto c = (x > 0) ? ((x < 1) ? x : T(1)) : T(0);
+    return (unsigned int)(c * T((1u << B) - 1) + T(0.5));
+}
+
+// Multiplies by the reciprocal, as the SIMD path does, so the array and
+// single-value unpacks agree; 0 and the maximum code still decode exactly.
+template<int B, class T>
+T unorm_decode(unsigned int bits) {
+    return T(bits & ((1u << B) - 1)) * (T(1) / T((1u << B) - 1));
+}
+
+template<class T>
+unsigned int pack_rgba8(const color4_t<T>& c) {
+    return unorm_encode<8>(c.r) | unorm_encode<8>(c.g) << 8 | unorm_encode<8>(c.b) << 16 | unorm_encode<8>(c.a) << 24;
+}
+
+template<class T>
+color4_t<T> unpack_rgba8(unsigned int bits) {
+    return color4_t<T>(unorm_decode<8, T>(bits), unorm_decode<8, T>(bits >> 8),
+                       unorm_decode<8, T>(bits >> 16), unorm_decode<8, T>(bits >> 24));
+}
+
+template<class T>
+unsigned int pack_bgra8(const color4_t<T>& c) {
+    return unorm_encode<8>(c.b) | unorm_encode<8>(c.g) << 8 | unorm_encode<8>(c.r) << 16 | unorm_encode<8>(c.a) << 24;
+}
+
+template<class T>
+color4_t<T> unpack_bgra8(unsigned int bits) {
+    return color4_t<T>(unorm_decode<8, T>(bits >> 16), unorm_decode<8, T>(bits >> 8),
+                       unorm_decode<8, T>(bits), unorm_decode<8, T>(bits >> 24));
+}
+
+template<class T>
+unsigned int pack_rgb10a2(const color4_t<T>& c) {
+    return unorm_encode<10>(c.r) | unorm_encode<10>(c.g) << 10 | unorm_encode<10>(c.b) << 20 | unorm_encode<2>(c.a) << 30;
+}
+
+template<class T>
+color4_t<T> unpack_rgb10a2(unsigned int bits) {
+    return color4_t<T>(unorm_decode<10, T>(bits), unorm_decode<10, T>(bits >> 10),
+                       unorm_decode<10, T>(bits >> 20), unorm_decode<2, T>(bits >> 30));
+}
+
+// B in the low bits, R in the high bits (DXGI_FORMAT_B5G6R5_UNORM)
+template<class T>
+unsigned short pack_rgb565(const color3_t<T>& c) {
+    return (unsigned short)(unorm_encode<5>(c.r) << 11 | unorm_encode<6>(c.g) << 5 | unorm_encode<5>(c.b));
+}
+
+template<class T>
+color3_t<T> unpack_rgb565(unsigned short bits) {
+    return color3_t<T>(unorm_decode<5, T>(bits >> 11), unorm_decode<6, T>(bits >> 5), unorm_decode<5, T>(bits));
+}
+
+// Unsigned float with a 5-bit exponent (bias 15) and M mantissa bits, as in
+// R11G11B10F. Rounds to nearest even, negative values become 0, finite
+// values past the largest representable one saturate to it.
+template<int M>
+unsigned int ufloat_encode(float f) {
+    unsigned int bits;
+    memcpy(&bits, &f, sizeof(bits));
+
+    if ((bits & 0x7fffffff) > 0x7f800000) {
+        return (31u << M) | 1;
+    }
+
+    if (bits & 0x80000000) {
+        return 0;
+    }
+
+    if (bits == 0x7f800000) {
+        return 31u << M;
+    }
+
+    const unsigned int maxFinite = (31u << M) - 1;
+    int e = int(bits >> 23) - 127 + 15;
+    auto mant = bits & 0x7fffff;
+    unsigned int value;
+    int shift;
+
+    if (e > 0) {
+        value = (unsigned int)e << 23 | mant;
+        shift = 23 - M;
+    } else {
+        value = mant | 0x800000;
+        shift = 23 - M + 1 - e;
+
+        if (shift > 24) {
+            return 0;
+        }
+    }
+
+    // Round to nearest even; a carry out of the mantissa bumps the exponent
+    auto rest = value & ((1u << shift) - 1);
+    auto midpoint = 1u << (shift - 1);
+    value >>= shift;
+
+    if (rest > midpoint || (rest == midpoint && (value & 1))) {
+        ++value;
+    }
+
+    return (value > maxFinite) ? maxFinite : value;
+}
+
+template<int M>
+float ufloat_decode(unsigned int bits) {
+    auto e = (bits >> M) & 31;
+    auto m = bits & ((1u << M) - 1);
+
+    if (e == 31) {
+        return m ? std::numeric_limits<float>::quiet_NaN() : std::numeric_limits<float>::infinity();
+    }
+
+    if (e == 0) {
+        return float(m) / float(1u << (14 + M));
+    }
+
+    auto f = (e - 15 + 127) << 23 | m << (23 - M);
+    float r;
+    memcpy(&r, &f, sizeof(r));
+    return r;
+}
+
+template<class T>
+unsigned int pack_r11g11b10f(const color3_t<T>& c) {
+    return ufloat_encode<6>(float(c.r)) | ufloat_encode<6>(float(c.g)) << 11 | ufloat_encode<5>(float(c.b)) << 22;
+}
+
+template<class T>
+color3_t<T> unpack_r11g11b10f(unsigned int bits) {
+    return color3_t<T>(T(ufloat_decode<6>(bits & 0x7ff)), T(ufloat_decode<6>((bits >> 11) & 0x7ff)),
+                       T(ufloat_decode<5>(bits >> 22)));
+}
+
+// Three 9-bit mantissas with a shared 5-bit exponent (bias 15, RGB9E5).
+// Channels are clamped to [0, 65408], NaN becomes 0.
+template<class T>
+unsigned int pack_rgb9e5(const color3_t<T>& c) {
+    const float maxValue = 65408;
+    float rgb[3] = { float(c.r), float(c.g), float(c.b) };
+
+    for (int i = 0; i < 3; ++i) {
+        rgb[i] = (rgb[i] > 0) ? ((rgb[i] < maxValue) ? rgb[i] : maxValue) : 0.0f;
+    }
+
+    auto maxc = (rgb[0] > rgb[1]) ? rgb[0] : rgb[1];
+    maxc = (maxc > rgb[2]) ? maxc : rgb[2];
+
+    // floor(log2(maxc)) from the float exponent, at least -16
+    unsigned int bits;
+    memcpy(&bits, &maxc, sizeof(bits));
+    int e = int(bits >> 23) - 127;
+    e = ((e < -16) ? -16 : e) + 16;
+
+    // Mantissa step 2^(e - 24); step up if the largest channel rounds to 512
+    auto step = [](int exp) {
+        unsigned int f = (unsigned int)(exp - 24 + 127) << 23;
+        float r;
+        memcpy(&r, &f, sizeof(r));
+        return r;
+    };
+
+    if ((unsigned int)(maxc / step(e) + 0.5f) == 512) {
+        ++e;
+    }
+
+    auto inv = 1 / step(e);
+    return (unsigned int)(rgb[0] * inv + 0.5f) |
+           (unsigned int)(rgb[1] * inv + 0.5f) << 9 |
+           (unsigned int)(rgb[2] * inv + 0.5f) << 18 |
+           (unsigned int)e << 27;
+}
+
+template<class T>
+color3_t<T> unpack_rgb9e5(unsigned int bits) {
+    unsigned int f = ((bits >> 27) + 127 - 24) << 23;
+    float step;
+    memcpy(&step, &f, sizeof(step));
+    return color3_t<T>(T((bits & 511) * step), T(((bits >> 9) & 511) * step), T(((bits >> 18) & 511) * step));
+}
+
+// Array versions
+template<class T>
+void pack_rgba8(unsigned int* out, const color4_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = pack_rgba8(in[i]);
+    }
+}
+
+template<class T>
+void unpack_rgba8(color4_t<T>* out, const unsigned int* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = unpack_rgba8<T>(in[i]);
+    }
+}
+
+template<class T>
+void pack_bgra8(unsigned int* out, const color4_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = pack_bgra8(in[i]);
+    }
+}
+
+template<class T>
+void unpack_bgra8(color4_t<T>* out, const unsigned int* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = unpack_bgra8<T>(in[i]);
+    }
+}
+
+template<class T>
+void pack_rgb10a2(unsigned int* out, const color4_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = pack_rgb10a2(in[i]);
+    }
+}
+
+template<class T>
+void unpack_rgb10a2(color4_t<T>* out, const unsigned int* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = unpack_rgb10a2<T>(in[i]);
+    }
+}
+
+template<class T>
+void pack_rgb565(unsigned short* out, const color3_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = pack_rgb565(in[i]);
+    }
+}
+
+template<class T>
+void unpack_rgb565(color3_t<T>* out, const unsigned short* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = unpack_rgb565<T>(in[i]);
+    }
+}
+
+template<class T>
+void pack_r11g11b10f(unsigned int* out, const color3_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = pack_r11g11b10f(in[i]);
+    }
+}
+
+template<class T>
+void unpack_r11g11b10f(color3_t<T>* out, const unsigned int* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = unpack_r11g11b10f<T>(in[i]);
+    }
+}
+
+template<class T>
+void pack_rgb9e5(unsigned int* out, const color3_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = pack_rgb9e5(in[i]);
+    }
+}
+
+template<class T>
+void unpack_rgb9e5(color3_t<T>* out, const unsigned int* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = unpack_rgb9e5<T>(in[i]);
+    }
+}
+
+#if defined(ZMATH_SIMD)
+// The normalized formats convert four pixels per iteration, transposed so
+// that each register holds one channel.
+inline simd4i unorm_encode(simd4f x, float scale) {
+    x = simd_min(simd_max(x, simd_zero()), simd_splat(1.0f));
+    return simd_ftoi(simd_madd(x, simd_splat(scale), simd_splat(0.5f)));
+}
+
+inline simd4f unorm_decode(simd4i bits, unsigned int mask) {
+    return simd_mul(simd_itof(simd_andi(bits, simd_splati(mask))), simd_splat(1.0f / mask));
+}
+
+inline void color4_load4(const color4_t<float>* in, simd4f& r, simd4f& g, simd4f& b, simd4f& a) {
+    r = simd_load(&in[0].r);
+    g = simd_load(&in[1].r);
+    b = simd_load(&in[2].r);
+    a = simd_load(&in[3].r);
+    simd_transpose(r, g, b, a);
+}
+
+inline void color4_store4(color4_t<float>* out, simd4f r, simd4f g, simd4f b, simd4f a) {
+    simd_transpose(r, g, b, a);
+    simd_store(&out[0].r, r);
+    simd_store(&out[1].r, g);
+    simd_store(&out[2].r, b);
+    simd_store(&out[3].r, a);
+}
+
+// Four color3_t are three registers: r0 g0 b0 r1 | g1 b1 r2 g2 | b2 r3 g3 b3
+inline void color3_load4(const color3_t<float>* in, simd4f& r, simd4f& g, simd4f& b) {
+    simd_load3x4(&in->r, r, g, b);
+}
+
+inline void color3_store4(color3_t<float>* out, simd4f r, simd4f g, simd4f b) {
+    simd_store3x4(&out->r, r, g, b);
+}
+
+template<>
+inline void pack_rgba8(unsigned int* out, const color4_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f r, g, b, a;
+        color4_load4(in + i * 4, r, g, b, a);
+        auto bits = simd_ori(simd_ori(unorm_encode(r, 255), simd_shli<8>(unorm_encode(g, 255))),
+                             simd_ori(simd_shli<16>(unorm_encode(b, 255)), simd_shli<24>(unorm_encode(a, 255))));
+        simd_storei(out + i * 4, bits);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = pack_rgba8(in[i]);
+    }
+}
+
+template<>
+inline void unpack_rgba8(color4_t<float>* out, const unsigned int* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        auto bits = simd_loadi(in + i * 4);
+        color4_store4(out + i * 4, unorm_decode(bits, 255), unorm_decode(simd_shri<8>(bits), 255),
+                      unorm_decode(simd_shri<16>(bits), 255), unorm_decode(simd_shri<24>(bits), 255));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = unpack_rgba8<float>(in[i]);
+    }
+}
+
+template<>
+inline void pack_bgra8(unsigned int* out, const color4_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f r, g, b, a;
+        color4_load4(in + i * 4, r, g, b, a);
+        auto bits = simd_ori(simd_ori(unorm_encode(b, 255), simd_shli<8>(unorm_encode(g, 255))),
+                             simd_ori(simd_shli<16>(unorm_encode(r, 255)), simd_shli<24>(unorm_encode(a, 255))));
+        simd_storei(out + i * 4, bits);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = pack_bgra8(in[i]);
+    }
+}
+
+template<>
+inline void unpack_bgra8(color4_t<float>* out, const unsigned int* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        auto bits = simd_loadi(in + i * 4);
+        color4_store4(out + i * 4, unorm_decode(simd_shri<16>(bits), 255), unorm_decode(simd_shri<8>(bits), 255),
+                      unorm_decode(bits, 255), unorm_decode(simd_shri<24>(bits), 255));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = unpack_bgra8<float>(in[i]);
+    }
+}
+
+template<>
+inline void pack_rgb10a2(unsigned int* out, const color4_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f r, g, b, a;
+        color4_load4(in + i * 4, r, g, b, a);
+        auto bits = simd_ori(simd_ori(unorm_encode(r, 1023), simd_shli<10>(unorm_encode(g, 1023))),
+                             simd_ori(simd_shli<20>(unorm_encode(b, 1023)), simd_shli<30>(unorm_encode(a, 3))));
+        simd_storei(out + i * 4, bits);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = pack_rgb10a2(in[i]);
+    }
+}
+
+template<>
+inline void unpack_rgb10a2(color4_t<float>* out, const unsigned int* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        auto bits = simd_loadi(in + i * 4);
+        color4_store4(out + i * 4, unorm_decode(bits, 1023), unorm_decode(simd_shri<10>(bits), 1023),
+                      unorm_decode(simd_shri<20>(bits), 1023), unorm_decode(simd_shri<30>(bits), 3));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = unpack_rgb10a2<float>(in[i]);
+    }
+}
+
+template<>
+inline void pack_rgb565(unsigned short* out, const color3_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f r, g, b;
+        color3_load4(in + i * 4, r, g, b);
+        auto bits = simd_ori(simd_ori(simd_shli<11>(unorm_encode(r, 31)), simd_shli<5>(unorm_encode(g, 63))),
+                             unorm_encode(b, 31));
+        unsigned int tmp[4];
+        simd_storei(tmp, bits);
+        out[i * 4 + 0] = (unsigned short)tmp[0];
+        out[i * 4 + 1] = (unsigned short)tmp[1];
+        out[i * 4 + 2] = (unsigned short)tmp[2];
+        out[i * 4 + 3] = (unsigned short)tmp[3];
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = pack_rgb565(in[i]);
+    }
+}
+
+template<>
+inline void unpack_rgb565(color3_t<float>* out, const unsigned short* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        unsigned int tmp[4] = { in[i * 4], in[i * 4 + 1], in[i * 4 + 2], in[i * 4 + 3] };
+        auto bits = simd_loadi(tmp);
+        color3_store4(out + i * 4, unorm_decode(simd_shri<11>(bits), 31), unorm_decode(simd_shri<5>(bits), 63),
+                      unorm_decode(bits, 31));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = unpack_rgb565<float>(in[i]);
+    }
+}
+#endif
@@ -0,0 +1,257 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// Unit dual quaternion for rigid transforms. It follows the same conventions
+// as mat4x3_t(q, pos): a point is rotated as p * mat3x3_t(q), then translated,
+// and a * b applies a first, then b.
+template<class T>
+struct dualquat_t {
+    quat_t<T> real; // rotation
+    quat_t<T> dual; // 0.5 * real * (pos, 0)
+
+    dualquat_t() : real(), dual(0, 0, 0, 0) {}
+    dualquat_t(const quat_t<T>& real, const quat_t<T>& dual) : real(real), dual(dual) {}
+    dualquat_t(const quat_t<T>& q, const vec3_t<T>& pos) : real(q), dual(q * quat_t<T>(pos.x, pos.y, pos.z, 0) * T(0.5)) {}
+
+    // The 3x3 part must be a rotation
+    explicit dualquat_t(const mat4x3_t<T>& m) {
+        real = quat_t<T>::from_matrix(mat3x3_t<T>(m.m11, m.m12, m.m13,
+                                                  m.m21, m.m22, m.m23,
+                                                  m.m31, m.m32, m.m33));
+        dual = real * quat_t<T>(m.m41, m.m42, m.m43, 0) * T(0.5);
+    }
+
+    // Unary operators
+    dualquat_t operator - () const {
+        return dualquat_t(-real, -dual);
+    }
+
+    // Inverse of a unit dual quaternion
+    dualquat_t operator ! () const {
+        return dualquat_t(!real, !dual);
+    }
+
+    // Binary operators
+    dualquat_t operator * (T f) const {
+        return dualquat_t(real * f, dual * f);
+    }
+
+    friend dualquat_t operator * (T f, const dualquat_t& dq) {
+        return dualquat_t(dq.real * f, dq.dual * f);
+    }
+
+    dualquat_t operator + (const dualquat_t& dq) const {
+        return dualquat_t(real + dq.real, dual + dq.dual);
+    }
+
+    dualquat_t operator - (const dualquat_t& dq) const {
+        return dualquat_t(real - dq.real, dual - dq.dual);
+    }
+
+    dualquat_t operator * (const dualquat_t& dq) const {
+        return dualquat_t(real * dq.real, real * dq.dual + dual * dq.real);
+    }
+
+    dualquat_t& operator *= (T f) {
+        real *= f;
+        dual *= f;
+        return *this;
+    }
+
+    dualquat_t& operator += (const dualquat_t& dq) {
+        real += dq.real;
+        dual += dq.dual;
+        return *this;
+    }
+
+    dualquat_t& operator *= (const dualquat_t& dq) {
+        return *this = *this * dq;
+    }
+
+    // Comparison operators
+    bool operator == (const dualquat_t& dq) const {
+        return real == dq.real && dual == dq.dual;
+    }
+
+    bool operator != (const dualquat_t& dq) const {
+        return real != dq.real || dual != dq.dual;
+    }
+
+    vec3_t<T> translation() const {
+        // Vector part of 2 * !real * dual
+        return vec3_t<T>(real.w * dual.x - dual.w * real.x - (real.y * dual.z - real.z * dual.y),
+                         real.w * dual.y - dual.w * real.y - (real.z * dual.x - real.x * dual.z),
+                         real.w * dual.z - dual.w * real.z - (real.x * dual.y - real.y * dual.x)) * T(2);
+    }
+};
+
+template<class T>
+dualquat_t<T> normalize(const dualquat_t<T>& dq) {
+    auto m = dq.real.length();
+
+    if (m > std::numeric_limits<T>::epsilon()) {
+        m = 1 / m;
+    } else {
+        m = 0;
+    }
+
+    return dualquat_t<T>(dq.real * m, dq.dual * m);
+}
+
+// Rotation only, e.g. for normals
+template<class T>
+vec3_t<T> transform_vector(const dualquat_t<T>& dq, const vec3_t<T>& v) {
+    // v * mat3x3_t(q) rotates by !q: v - 2w (u x v) + 2 u x (u x v)
+    vec3_t<T> u(dq.real.x, dq.real.y, dq.real.z);
+    auto c = cross(u, v);
+    return v + (cross(u, c) - c * dq.real.w) * T(2);
+}
+
+template<class T>
+vec3_t<T> transform_point(const dualquat_t<T>& dq, const vec3_t<T>& p) {
+    return transform_vector(dq, p) + dq.translation();
+}
+
+// Dual quaternion linear blending. Every input is flipped into the hemisphere
+// of the first one, so blending q and -q (the same rotation) does not cancel.
+template<class T>
+dualquat_t<T> blend(const dualquat_t<T>* dqs, const T* weights, size_t count) {
+    dualquat_t<T> r(quat_t<T>(0, 0, 0, 0), quat_t<T>(0, 0, 0, 0));
+
+    for (size_t i = 0; i < count; ++i) {
+        auto w = (dot(dqs[i].real, dqs[0].real) < 0) ? -weights[i] : weights[i];
+        r += dqs[i] * w;
+    }
+
+    return normalize(r);
+}
+
+// Dual quaternion skinning, the same interface as the mat4x3_t palette
+// overload in skinning.h: four bones and weights per vertex, vertices
+// [begin, end) only. It keeps volume at twisting joints where linear blend
+// skinning collapses, but each vertex costs about 1.5-2x as much: applying the
+// blended dual quaternion takes more work than the cheaper blend saves.
+template<class T>
+void skin_vertices(vec3_t<T>* outPositions, vec3_t<T>* outNormals, size_t outStride,
+                   const vec3_t<T>* positions, const vec3_t<T>* normals, size_t inStride,
+                   const unsigned char* bones, const T* weights, const dualquat_t<T>* palette,
+                   size_t begin, size_t end) {
+    auto dst = reinterpret_cast<char*>(outPositions) + begin * outStride;
+    auto src = reinterpret_cast<const char*>(positions) + begin * inStride;
+    auto skinNormals = outNormals && normals;
+
+    for (auto i = begin; i < end; ++i, dst += outStride, src += inStride) {
+        auto b = bones + i * 4;
+        const dualquat_t<T> dqs[4] = { palette[b[0]], palette[b[1]], palette[b[2]], palette[b[3]] };
+        auto dq = blend(dqs, weights + i * 4, 4);
+
+        *reinterpret_cast<vec3_t<T>*>(dst) = transform_point(dq, *reinterpret_cast<const vec3_t<T>*>(src));
+
+        if (skinNormals) {
+            auto srcNormal = reinterpret_cast<const char*>(normals) + i * inStride;
+            auto dstNormal = reinterpret_cast<char*>(outNormals) + i * outStride;
+            *reinterpret_cast<vec3_t<T>*>(dstNormal) = transform_vector(dq, *reinterpret_cast<const vec3_t<T>*>(srcNormal));
+        }
+    }
+}
+
+template<class T>
+void skin_vertices(vec3_t<T>* outPositions, vec3_t<T>* outNormals,
+                   const vec3_t<T>* positions, const vec3_t<T>* normals,
+                   const unsigned char* bones, const T* weights, const dualquat_t<T>* palette,
+                   size_t begin, size_t end) {
+    skin_vertices(outPositions, outNormals, sizeof(vec3_t<T>), positions, normals, sizeof(vec3_t<T>),
+                  bones, weights, palette, begin, end);
+}
+
+#if defined(ZMATH_SIMD)
+// A dual quaternion is two registers, so blending four bones is eight madds
+// (against 12 for a mat4x3_t), and the blended result is applied directly with
+// register cross products instead of being expanded into a matrix.
+inline simd4f dualquat_cross(simd4f a, simd4f b) {
+    // (a * b.yzx - a.yzx * b).yzx; lane 3 stays a.w * b.w - a.w * b.w = 0
+    auto c = simd_sub(simd_mul(a, simd_shuffle<1, 2, 0, 3>(b, b)), simd_mul(simd_shuffle<1, 2, 0, 3>(a, a), b));
+    return simd_shuffle<1, 2, 0, 3>(c, c);
+}
+
+// 4-component dot product broadcast to every lane
+inline simd4f dualquat_dot(simd4f a, simd4f b) {
+    auto t = simd_mul(a, b);
+    t = simd_add(t, simd_zwxy(t));
+    return simd_add(t, simd_yxwz(t));
+}
+
+template<>
+inline void skin_vertices(vec3_t<float>* outPositions, vec3_t<float>* outNormals, size_t outStride,
+                          const vec3_t<float>* positions, const vec3_t<float>* normals, size_t inStride,
+                          const unsigned char* bones, const float* weights, const dualquat_t<float>* palette,
+                          size_t begin, size_t end) {
+    auto dst = reinterpret_cast<char*>(outPositions) + begin * outStride;
+    auto src = reinterpret_cast<const char*>(positions) + begin * inStride;
+    auto skinNormals = outNormals && normals;
+    auto zero = simd_zero();
+    auto two = simd_splat(2.0f);
+
+    for (auto i = begin; i < end; ++i, dst += outStride, src += inStride) {
+        auto b = bones + i * 4;
+        auto w = weights + i * 4;
+        auto pivot = simd_load(&palette[b[0]].real.x);
+        auto real = simd_zero();
+        auto dual = simd_zero();
+
+        for (int k = 0; k < 4; ++k) {
+            auto r = simd_load(&palette[b[k]].real.x);
+            auto wk = simd_splat(w[k]);
+            wk = simd_select(simd_cmplt(dualquat_dot(r, pivot), zero), simd_sub(zero, wk), wk);
+            real = simd_madd(r, wk, real);
+            dual = simd_madd(simd_load(&palette[b[k]].dual.x), wk, dual);
+        }
+
+        auto len = simd_sqrt(dualquat_dot(real, real));
+        auto valid = simd_cmpgt(len, simd_splat(std::numeric_limits<float>::epsilon()));
+        real = simd_select(valid, simd_div(real, len), zero);
+        dual = simd_select(valid, simd_div(dual, len), zero);
+
+        // See transform_vector() and translation()
+        auto rw = simd_wwww(real);
+        auto t = simd_sub(simd_mul(rw, dual), simd_madd(simd_wwww(dual), real, dualquat_cross(real, dual)));
+        t = simd_mul(t, two);
+
+        auto p = reinterpret_cast<const float*>(src);
+        auto v = simd_set(p[0], p[1], p[2], 0);
+        auto c = dualquat_cross(real, v);
+        v = simd_add(simd_madd(simd_sub(dualquat_cross(real, c), simd_mul(c, rw)), two, v), t);
+        simd_store3(reinterpret_cast<float*>(dst), v);
+
+        if (skinNormals) {
+            auto srcNormal = reinterpret_cast<const char*>(normals) + i * inStride;
+            auto dstNormal = reinterpret_cast<char*>(outNormals) + i * outStride;
+            auto n = reinterpret_cast<const float*>(srcNormal);
+            v = simd_set(n[0], n[1], n[2], 0);
+            c = dualquat_cross(real, v);
+            v = simd_madd(simd_sub(dualquat_cross(real, c), simd_mul(c, rw)), two, v);
+            simd_store3(reinterpret_cast<float*>(dstNormal), v);
+        }
+    }
+}
+#endif
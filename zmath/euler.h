@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// Batch rotations from (pitch, yaw, roll) triples, e.g. orientations read from
+// gameplay data. Each element is the rotation(pitch, yaw, roll) factory of the
+// output type. The float versions evaluate four at a time with simd_sincos, so
+// they match the factory only within the sincos_fast error; elements differ by
+// a few 1e-7.
+template<class T>
+void quat_from_euler(quat_t<T>* out, const vec3_t<T>* angles, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = quat_t<T>::rotation(angles[i].x, angles[i].y, angles[i].z);
+    }
+}
+
+template<class T>
+void mat_from_euler(mat3x3_t<T>* out, const vec3_t<T>* angles, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = mat3x3_t<T>::rotation(angles[i].x, angles[i].y, angles[i].z);
+    }
+}
+
+template<class T>
+void mat_from_euler(mat4x3_t<T>* out, const vec3_t<T>* angles, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = mat4x3_t<T>::rotation(angles[i].x, angles[i].y, angles[i].z);
+    }
+}
+
+template<class T>
+void mat_from_euler(mat4x4_t<T>* out, const vec3_t<T>* angles, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = mat4x4_t<T>::rotation(angles[i].x, angles[i].y, angles[i].z);
+    }
+}
+
+#if defined(ZMATH_SIMD)
+// rotation_y(yaw) * rotation_x(pitch) * rotation_z(roll) for four triples
+inline void quat_from_euler4(quat_t<float>* out, const vec3_t<float>* angles) {
+    simd4f pitch, yaw, roll, sx, cx, sy, cy, sz, cz;
+    auto scale = simd_splat(0.5f);
+    simd_load3x4(&angles[0].x, pitch, yaw, roll);
+    simd_sincos(simd_mul(pitch, scale), sx, cx);
+    simd_sincos(simd_mul(yaw, scale), sy, cy);
+    simd_sincos(simd_mul(roll, scale), sz, cz);
+
+    auto px = simd_mul(cy, sx);
+    auto py = simd_mul(sy, cx);
+    auto pz = simd_sub(simd_zero(), simd_mul(sy, sx));
+    auto pw = simd_mul(cy, cx);
+    auto x = simd_madd(px, cz, simd_mul(py, sz));
+    auto y = simd_sub(simd_mul(py, cz), simd_mul(px, sz));
+    auto z = simd_madd(pw, sz, simd_mul(pz, cz));
+    auto w = simd_sub(simd_mul(pw, cz), simd_mul(pz, sz));
+    simd_transpose(x, y, z, w);
+    simd_store(&out[0].x, x);
+    simd_store(&out[1].x, y);
+    simd_store(&out[2].x, z);
+    simd_store(&out[3].x, w);
+}
+
+// The nine elements of rotation(pitch, yaw, roll) for four triples, one
+// register per element in row order
+inline void simd_euler_rotation(const vec3_t<float>* angles, simd4f (&m)[9]) {
+    simd4f pitch, yaw, roll, sx, cx, sy, cy, sz, cz;
+    simd_load3x4(&angles[0].x, pitch, yaw, roll);
+    simd_sincos(pitch, sx, cx);
+    simd_sincos(yaw, sy, cy);
+    simd_sincos(roll, sz, cz);
+
+    auto zero = simd_zero();
+    auto c1 = simd_mul(cy, simd_sub(zero, sz));
+    auto c2 = simd_mul(sy, sz);
+    m[0] = simd_mul(cy, cz);
+    m[1] = simd_madd(c1, cx, simd_mul(sy, sx));
+    m[2] = simd_sub(simd_mul(sy, cx), simd_mul(c1, sx));
+    m[3] = sz;
+    m[4] = simd_mul(cz, cx);
+    m[5] = simd_sub(zero, simd_mul(cz, sx));
+    m[6] = simd_sub(zero, simd_mul(sy, cz));
+    m[7] = simd_madd(c2, cx, simd_mul(cy, sx));
+    m[8] = simd_sub(simd_mul(cy, cx), simd_mul(c2, sx));
+}
+
+inline void mat3x3_from_euler4(mat3x3_t<float>* out, const vec3_t<float>* angles) {
+    simd4f m[9];
+    float e[9][4];
+    simd_euler_rotation(angles, m);
+    for (int k = 0; k < 9; ++k) {
+        simd_store(e[k], m[k]);
+    }
+    for (int i = 0; i < 4; ++i) {
+        out[i] = mat3x3_t<float>(e[0][i], e[1][i], e[2][i],
+                                 e[3][i], e[4][i], e[5][i],
+                                 e[6][i], e[7][i], e[8][i]);
+    }
+}
+
+inline void mat4x3_from_euler4(mat4x3_t<float>* out, const vec3_t<float>* angles) {
+    simd4f m[9];
+    float e[9][4];
+    simd_euler_rotation(angles, m);
+    for (int k = 0; k < 9; ++k) {
+        simd_store(e[k], m[k]);
+    }
+    for (int i = 0; i < 4; ++i) {
+        out[i] = mat4x3_t<float>(e[0][i], e[1][i], e[2][i],
+                                 e[3][i], e[4][i], e[5][i],
+                                 e[6][i], e[7][i], e[8][i],
+                                 0,       0,       0      );
+    }
+}
+
+// Each row triple transposes straight into that row of the four matrices
+inline void mat4x4_from_euler4(mat4x4_t<float>* out, const vec3_t<float>* angles) {
+    simd4f m[9];
+    simd_euler_rotation(angles, m);
+
+    for (int row = 0; row < 3; ++row) {
+        auto a = m[row * 3];
+        auto b = m[row * 3 + 1];
+        auto c = m[row * 3 + 2];
+        auto d = simd_zero();
+        simd_transpose(a, b, c, d);
+        simd_store(out[0].m[row], a);
+        simd_store(out[1].m[row], b);
+        simd_store(out[2].m[row], c);
+        simd_store(out[3].m[row], d);
+    }
+
+    auto w = simd_set(0, 0, 0, 1);
+    for (int i = 0; i < 4; ++i) {
+        simd_store(out[i].m[3], w);
+    }
+}
+
+template<>
+inline void quat_from_euler(quat_t<float>* out, const vec3_t<float>* angles, size_t count) {
+    simd_for_blocks(out, angles, count, quat_from_euler4);
+}
+
+template<>
+inline void mat_from_euler(mat3x3_t<float>* out, const vec3_t<float>* angles, size_t count) {
+    simd_for_blocks(out, angles, count, mat3x3_from_euler4);
+}
+
+template<>
+inline void mat_from_euler(mat4x3_t<float>* out, const vec3_t<float>* angles, size_t count) {
+    simd_for_blocks(out, angles, count, mat4x3_from_euler4);
+}
+
+template<>
+inline void mat_from_euler(mat4x4_t<float>* out, const vec3_t<float>* angles, size_t count) {
+    simd_for_blocks(out, angles, count, mat4x4_from_euler4);
+}
+#endif
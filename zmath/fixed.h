@@ -0,0 +1,464 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+inline int32_t fixed_mul(int32_t a, int32_t b, int f) {
+    return int32_t((int64_t(a) * b + (int64_t(1) << (f - 1))) >> f);
+}
+
+inline int32_t fixed_div(int32_t a, int32_t b, int f) {
+    return int32_t(int64_t(a) * (int64_t(1) << f) / b);
+}
+
+// Portable 64-bit versions for compilers without __int128. They produce
+// the same bits as the __int128 ones, overflow included.
+inline int64_t fixed_mul_portable(int64_t a, int64_t b, int f) {
+    // Unsigned 64x64 -> 128 product, corrected to the signed one
+    auto ua = uint64_t(a), ub = uint64_t(b);
+    auto ll = (ua & 0xffffffff) * (ub & 0xffffffff);
+    auto lh = (ua & 0xffffffff) * (ub >> 32);
+    auto hl = (ua >> 32) * (ub & 0xffffffff);
+    auto mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+    auto lo = (mid << 32) | (ll & 0xffffffff);
+    auto hi = (ua >> 32) * (ub >> 32) + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    hi -= ((a < 0) ? ub : 0) + ((b < 0) ? ua : 0);
+
+    auto round = uint64_t(1) << (f - 1);
+    lo += round;
+    hi += (lo < round) ? 1 : 0;
+    return int64_t((lo >> f) | (hi << (64 - f)));
+}
+
+inline int64_t fixed_div_portable(int64_t a, int64_t b, int f) {
+    // Long division of |a| << f by |b|, keeping the low 64 quotient bits
+    auto ua = (a < 0) ? 0 - uint64_t(a) : uint64_t(a);
+    auto ub = (b < 0) ? 0 - uint64_t(b) : uint64_t(b);
+    uint64_t num[2] = { ua >> (64 - f), ua << f };
+    uint64_t q = 0, rem = 0;
+
+    for (int i = 0; i < 128; ++i) {
+        rem = (rem << 1) | (num[i / 64] >> (63 - i % 64) & 1);
+        q <<= 1;
+
+        if (rem >= ub) {
+            rem -= ub;
+            q |= 1;
+        }
+    }
+
+    return int64_t(((a < 0) != (b < 0)) ? 0 - q : q);
+}
+
+inline int64_t fixed_mul(int64_t a, int64_t b, int f) {
+#if defined(__SIZEOF_INT128__)
+    return int64_t((__int128(a) * b + (__int128(1) << (f - 1))) >> f);
+#else
+    return fixed_mul_portable(a, b, f);
+#endif
+}
+
+inline int64_t fixed_div(int64_t a, int64_t b, int f) {
+#if defined(__SIZEOF_INT128__)
+    return int64_t(__int128(a) * (__int128(1) << f) / b);
+#else
+    return fixed_div_portable(a, b, f);
+#endif
+}
+
+// Fixed-point scalar with F fraction bits in the signed integer I, for
+// results that are bit-identical on every platform. All operations are
+// integer arithmetic; only the conversions from and to floating point
+// involve floats. Products round to nearest, quotients and sqrt truncate.
+// Overflow wraps, so fixed32 (Q16.16) vectors should stay below 128 in
+// length for dot products to fit.
+template<class I, int F>
+struct fixed_t {
+    static_assert(F > 0 && F < int(sizeof(I)) * 8 - 1 && F % 2 == 0, "F must be even and leave integer bits");
+
+    typedef typename std::make_unsigned<I>::type U;
+
+    I raw;
+
+    fixed_t() = default;
+    template<class N, class = typename std::enable_if<std::is_integral<N>::value>::type>
+    ZMATH_CONSTEXPR fixed_t(N i) : raw(I(U(i) << F)) {}
+    ZMATH_CONSTEXPR fixed_t(double d) : raw(I(d * double(I(1) << F) + ((d < 0) ? -0.5 : 0.5))) {}
+
+    explicit ZMATH_CONSTEXPR operator float() const {
+        return float(raw) / float(I(1) << F);
+    }
+
+    explicit ZMATH_CONSTEXPR operator double() const {
+        return double(raw) / double(I(1) << F);
+    }
+
+    // Truncates toward zero like the float to integer conversion
+    template<class N, class = typename std::enable_if<std::is_integral<N>::value>::type>
+    explicit ZMATH_CONSTEXPR operator N() const {
+        return N(raw / (I(1) << F));
+    }
+
+    static fixed_t from_raw(I raw) {
+        fixed_t r;
+        r.raw = raw;
+        return r;
+    }
+
+    // Unary operators
+    fixed_t operator - () const {
+        return from_raw(I(U(0) - U(raw)));
+    }
+
+    // Binary operators
+    friend fixed_t operator + (fixed_t a, fixed_t b) {
+        return from_raw(I(U(a.raw) + U(b.raw)));
+    }
+
+    friend fixed_t operator - (fixed_t a, fixed_t b) {
+        return from_raw(I(U(a.raw) - U(b.raw)));
+    }
+
+    friend fixed_t operator * (fixed_t a, fixed_t b) {
+        return from_raw(fixed_mul(a.raw, b.raw, F));
+    }
+
+    friend fixed_t operator / (fixed_t a, fixed_t b) {
+        assert(b.raw != 0);
+        return from_raw(fixed_div(a.raw, b.raw, F));
+    }
+
+    fixed_t& operator += (fixed_t f) {
+        raw = I(U(raw) + U(f.raw));
+        return *this;
+    }
+
+    fixed_t& operator -= (fixed_t f) {
+        raw = I(U(raw) - U(f.raw));
+        return *this;
+    }
+
+    fixed_t& operator *= (fixed_t f) {
+        return *this = *this * f;
+    }
+
+    fixed_t& operator /= (fixed_t f) {
+        return *this = *this / f;
+    }
+
+    friend ZMATH_CONSTEXPR bool operator == (fixed_t a, fixed_t b) {
+        return a.raw == b.raw;
+    }
+
+    friend ZMATH_CONSTEXPR bool operator != (fixed_t a, fixed_t b) {
+        return a.raw != b.raw;
+    }
+
+    friend ZMATH_CONSTEXPR bool operator < (fixed_t a, fixed_t b) {
+        return a.raw < b.raw;
+    }
+
+    friend ZMATH_CONSTEXPR bool operator > (fixed_t a, fixed_t b) {
+        return a.raw > b.raw;
+    }
+
+    friend ZMATH_CONSTEXPR bool operator <= (fixed_t a, fixed_t b) {
+        return a.raw <= b.raw;
+    }
+
+    friend ZMATH_CONSTEXPR bool operator >= (fixed_t a, fixed_t b) {
+        return a.raw >= b.raw;
+    }
+};
+
+template<class I, int F>
+fixed_t<I, F> fabs(fixed_t<I, F> x) {
+    return (x.raw < 0) ? -x : x;
+}
+
+template<class I, int F>
+fixed_t<I, F> abs(fixed_t<I, F> x) {
+    return fabs(x);
+}
+
+// Every fixed-point value is finite; for generic code that calls isfinite
+template<class I, int F>
+bool isfinite(fixed_t<I, F>) {
+    return true;
+}
+
+// Digit-by-digit square root, truncated; negative inputs give 0
+template<class I, int F>
+fixed_t<I, F> sqrt(fixed_t<I, F> x) {
+    typedef typename fixed_t<I, F>::U U;
+    const int bits = int(sizeof(I)) * 8;
+
+    if (x.raw <= 0) {
+        return fixed_t<I, F>(0);
+    }
+
+    // Leading zero digit pairs leave root and remainder at zero. Feeding
+    // F / 2 more zero pairs at the end scales the root by 2^(F / 2).
+    auto v = U(x.raw);
+    U root = 0, rem = 0;
+    int i = 0;
+
+    for (; (v >> (bits - 2)) == 0; v <<= 2) {
+        ++i;
+    }
+
+    for (; i < bits / 2 + F / 2; ++i) {
+        rem = (rem << 2) | (v >> (bits - 2));
+        v <<= 2;
+        root <<= 1;
+
+        if (rem >= 2 * root + 1) {
+            rem -= 2 * root + 1;
+            root |= 1;
+        }
+    }
+
+    return fixed_t<I, F>::from_raw(I(root));
+}
+
+// Reduces x to [-pi, pi) by the nearest multiple of 2pi. Works on the whole
+// range: the truncated quotient keeps every product within |x|.
+template<class I, int F>
+fixed_t<I, F> fixed_reduce_angle(fixed_t<I, F> x) {
+    const fixed_t<I, F> pi(3.141592653589793);
+
+    // 2pi in raw units plus its remainder in units of 2^-F raw (Cody-Waite),
+    // so that large arguments reduce without accumulating the rounding
+    const double scale = double(I(1) << F), twoPiHi = 6.283185307179586, twoPiLo = 2.4492935982947064e-16;
+    const auto twoPi = I(twoPiHi * scale + 0.5);
+    const auto twoPiRest = I(((twoPiHi * scale - double(twoPi)) + twoPiLo * scale) * scale);
+
+    auto n = x.raw / twoPi;
+    auto r = x.raw - n * twoPi;
+
+    if (r >= twoPi - pi.raw) {
+        r -= twoPi;
+        ++n;
+    } else if (r < -pi.raw) {
+        r += twoPi;
+        --n;
+    }
+
+    return fixed_t<I, F>::from_raw(r - ((n * twoPiRest) >> F));
+}
+
+// Taylor series after reduction to [-pi/2, pi/2]; F / 4 + 1 terms keep the
+// truncation error below one unit in the last place
+template<class I, int F>
+fixed_t<I, F> sin(fixed_t<I, F> x) {
+    typedef fixed_t<I, F> T;
+    const T pi(3.141592653589793), halfPi(1.5707963267948966);
+
+    x = fixed_reduce_angle(x);
+
+    if (x > halfPi) {
+        x = pi - x;
+    } else if (x < -halfPi) {
+        x = -pi - x;
+    }
+
+    auto x2 = x * x;
+    T s(1);
+
+    for (int k = F / 4; k > 0; --k) {
+        s = T(1) - T::from_raw((x2 * s).raw / I((2 * k) * (2 * k + 1)));
+    }
+
+    return x * s;
+}
+
+template<class I, int F>
+fixed_t<I, F> cos(fixed_t<I, F> x) {
+    return sin(fixed_reduce_angle(x) + fixed_t<I, F>(1.5707963267948966));
+}
+
+template<class I, int F>
+fixed_t<I, F> tan(fixed_t<I, F> x) {
+    return sin(x) / cos(x);
+}
+
+// One argument halving brings |z| <= 1 below tan(pi / 8) for the series
+template<class I, int F>
+fixed_t<I, F> atan2(fixed_t<I, F> y, fixed_t<I, F> x) {
+    typedef fixed_t<I, F> T;
+    const T pi(3.141592653589793), halfPi(1.5707963267948966);
+
+    auto ax = fabs(x), ay = fabs(y);
+
+    if (ax.raw == 0 && ay.raw == 0) {
+        return T(0);
+    }
+
+    auto z = (ay <= ax) ? ay / ax : ax / ay;
+
+    z = z / (T(1) + sqrt(T(1) + z * z));
+
+    auto z2 = z * z;
+    auto s = T(1) / T(2 * (F / 3) + 1);
+
+    for (int k = F / 3 - 1; k >= 0; --k) {
+        s = T(1) / T(2 * k + 1) - z2 * s;
+    }
+
+    auto a = T::from_raw((z * s).raw * 2);
+
+    if (ay > ax) {
+        a = halfPi - a;
+    }
+
+    if (x.raw < 0) {
+        a = pi - a;
+    }
+
+    return (y.raw < 0) ? -a : a;
+}
+
+template<class I, int F>
+fixed_t<I, F> atan(fixed_t<I, F> x) {
+    return atan2(x, fixed_t<I, F>(1));
+}
+
+template<class I, int F>
+fixed_t<I, F> asin(fixed_t<I, F> x) {
+    return atan2(x, sqrt((fixed_t<I, F>(1) - x) * (fixed_t<I, F>(1) + x)));
+}
+
+template<class I, int F>
+fixed_t<I, F> acos(fixed_t<I, F> x) {
+    return atan2(sqrt((fixed_t<I, F>(1) - x) * (fixed_t<I, F>(1) + x)), x);
+}
+
+// Normalizes count components in place. They are first scaled by a power
+// of two that brings the largest into [0.5, 1), so the squares neither
+// overflow nor lose the bits of short vectors. Zero stays zero.
+template<class I, int F>
+void fixed_normalize(fixed_t<I, F>* c, int count) {
+    typedef fixed_t<I, F> T;
+    typedef typename T::U U;
+    U m = 0;
+
+    for (int i = 0; i < count; ++i) {
+        auto a = (c[i].raw < 0) ? U(0) - U(c[i].raw) : U(c[i].raw);
+        m = (a > m) ? a : m;
+    }
+
+    if (m == 0) {
+        return;
+    }
+
+    int e = 0;
+
+    for (; m >= (U(1) << F); m >>= 1) {
+        ++e;
+    }
+
+    for (; m < (U(1) << (F - 1)); m <<= 1) {
+        --e;
+    }
+
+    T sum(0);
+
+    for (int i = 0; i < count; ++i) {
+        c[i].raw = (e > 0) ? (c[i].raw >> e) : c[i].raw * (I(1) << -e);
+        sum += c[i] * c[i];
+    }
+
+    auto inv = T(1) / sqrt(sum);
+
+    for (int i = 0; i < count; ++i) {
+        c[i] *= inv;
+    }
+}
+
+template<class I, int F>
+vec2_t<fixed_t<I, F>> normalize(const vec2_t<fixed_t<I, F>>& v) {
+    auto r = v;
+    fixed_normalize(&r.x, 2);
+    return r;
+}
+
+template<class I, int F>
+vec3_t<fixed_t<I, F>> normalize(const vec3_t<fixed_t<I, F>>& v) {
+    auto r = v;
+    fixed_normalize(&r.x, 3);
+    return r;
+}
+
+template<class I, int F>
+vec4_t<fixed_t<I, F>> normalize(const vec4_t<fixed_t<I, F>>& v) {
+    auto r = v;
+    fixed_normalize(&r.x, 4);
+    return r;
+}
+
+template<class I, int F>
+quat_t<fixed_t<I, F>> normalize(const quat_t<fixed_t<I, F>>& q) {
+    auto r = q;
+    fixed_normalize(&r.x, 4);
+    return r;
+}
+
+namespace std {
+template<class I, int F>
+class numeric_limits<fixed_t<I, F>> {
+public:
+    static const bool is_specialized = true;
+    static fixed_t<I, F> min() { return fixed_t<I, F>::from_raw(1); }
+    static fixed_t<I, F> max() { return fixed_t<I, F>::from_raw(numeric_limits<I>::max()); }
+    static fixed_t<I, F> lowest() { return fixed_t<I, F>::from_raw(numeric_limits<I>::min()); }
+    static const int digits = numeric_limits<I>::digits;
+    static const int digits10 = numeric_limits<I>::digits10;
+    static const int max_digits10 = 0;
+    static const bool is_signed = true;
+    static const bool is_integer = false;
+    static const bool is_exact = true;
+    static const int radix = 2;
+    static fixed_t<I, F> epsilon() { return fixed_t<I, F>::from_raw(1); }
+    static fixed_t<I, F> round_error() { return fixed_t<I, F>::from_raw(I(1) << (F - 1)); }
+    static const int min_exponent = 0;
+    static const int min_exponent10 = 0;
+    static const int max_exponent = 0;
+    static const int max_exponent10 = 0;
+    static const bool has_infinity = false;
+    static const bool has_quiet_NaN = false;
+    static const bool has_signaling_NaN = false;
+    static const float_denorm_style has_denorm = denorm_absent;
+    static const bool has_denorm_loss = false;
+    static fixed_t<I, F> infinity() { return fixed_t<I, F>(0); }
+    static fixed_t<I, F> quiet_NaN() { return fixed_t<I, F>(0); }
+    static fixed_t<I, F> signaling_NaN() { return fixed_t<I, F>(0); }
+    static fixed_t<I, F> denorm_min() { return fixed_t<I, F>(0); }
+    static const bool is_iec559 = false;
+    static const bool is_bounded = true;
+    static const bool is_modulo = true;
+    static const bool traps = false;
+    static const bool tinyness_before = false;
+    static const float_round_style round_style = round_toward_zero;
+};
+} // namespace std
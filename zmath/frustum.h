@@ -0,0 +1,358 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// Clip-space depth range of the projection the frustum is extracted from.
+// perspectiveLH/RH map to neither, see frustum_t::perspective.
+enum clip_depth {
+    CLIP_DEPTH_NEGATIVE_ONE_TO_ONE, // OpenGL-style projections
+    CLIP_DEPTH_ZERO_TO_ONE,         // orthoLH, orthoRH, Direct3D-style projections
+};
+
+enum cull_result {
+    CULL_OUTSIDE,
+    CULL_INTERSECT,
+    CULL_INSIDE,
+};
+
+template<class T>
+struct frustum_t {
+    enum {
+        PLANE_LEFT,
+        PLANE_RIGHT,
+        PLANE_BOTTOM,
+        PLANE_TOP,
+        PLANE_NEAR,
+        PLANE_FAR,
+        PLANE_COUNT,
+    };
+
+    // Normalized, with the normals pointing inside
+    plane_t<T> planes[PLANE_COUNT];
+
+    frustum_t() {}
+
+    // Gribb/Hartmann extraction from a (view *) projection matrix. Handedness is
+    // already baked into the matrix, so LH and RH projections are handled alike.
+    explicit frustum_t(const mat4x4_t<T>& m, clip_depth depth = CLIP_DEPTH_NEGATIVE_ONE_TO_ONE) :
+        frustum_t(m, (depth == CLIP_DEPTH_ZERO_TO_ONE) ? T(0) : T(-1), T(1)) {}
+
+    // As above for a projection that maps the near and far planes to the clip
+    // depths minDepth and maxDepth (z / w).
+    frustum_t(const mat4x4_t<T>& m, T minDepth, T maxDepth) {
+        planes[PLANE_LEFT]   = normalize(plane_t<T>(m.m14 + m.m11, m.m24 + m.m21, m.m34 + m.m31, m.m44 + m.m41));
+        planes[PLANE_RIGHT]  = normalize(plane_t<T>(m.m14 - m.m11, m.m24 - m.m21, m.m34 - m.m31, m.m44 - m.m41));
+        planes[PLANE_BOTTOM] = normalize(plane_t<T>(m.m14 + m.m12, m.m24 + m.m22, m.m34 + m.m32, m.m44 + m.m42));
+        planes[PLANE_TOP]    = normalize(plane_t<T>(m.m14 - m.m12, m.m24 - m.m22, m.m34 - m.m32, m.m44 - m.m42));
+        planes[PLANE_NEAR]   = normalize(plane_t<T>(m.m13 - minDepth * m.m14, m.m23 - minDepth * m.m24,
+                                                    m.m33 - minDepth * m.m34, m.m43 - minDepth * m.m44));
+        planes[PLANE_FAR]    = normalize(plane_t<T>(maxDepth * m.m14 - m.m13, maxDepth * m.m24 - m.m23,
+                                                    maxDepth * m.m34 - m.m33, maxDepth * m.m44 - m.m43));
+    }
+
+    // Frustum of view * perspectiveLH/RH(fov, aspect, minZ, maxZ). Both map minZ
+    // to the clip depth -maxZ / (maxZ - minZ) and maxZ to
+    // (maxZ - 2 * minZ) / (maxZ - minZ) rather than to -1 and 1.
+    static frustum_t perspective(const mat4x4_t<T>& m, T minZ, T maxZ) {
+        return frustum_t(m, -maxZ / (maxZ - minZ), (maxZ - 2 * minZ) / (maxZ - minZ));
+    }
+
+    bool contains(const vec3_t<T>& p) const {
+        for (int i = 0; i < PLANE_COUNT; ++i) {
+            if (dot(planes[i], p) < 0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Sphere
+    cull_result classify(const vec3_t<T>& center, T radius) const {
+        auto result = CULL_INSIDE;
+
+        for (int i = 0; i < PLANE_COUNT; ++i) {
+            auto d = dot(planes[i], center);
+
+            if (d < -radius) {
+                return CULL_OUTSIDE;
+            }
+
+            if (d < radius) {
+                result = CULL_INTERSECT;
+            }
+        }
+
+        return result;
+    }
+
+    // Axis-aligned box given by its corners
+    cull_result classify(const vec3_t<T>& min, const vec3_t<T>& max) const {
+        auto center = (min + max) * T(0.5);
+        auto extents = (max - min) * T(0.5);
+        auto result = CULL_INSIDE;
+
+        for (int i = 0; i < PLANE_COUNT; ++i) {
+            auto d = dot(planes[i], center);
+            auto r = dot(abs(planes[i].normal), extents);
+
+            if (d < -r) {
+                return CULL_OUTSIDE;
+            }
+
+            if (d < r) {
+                result = CULL_INTERSECT;
+            }
+        }
+
+        return result;
+    }
+
+    cull_result classify(const aabb_t<T>& box) const {
+        return classify(box.min, box.max);
+    }
+};
+
+// Batched culling. cache is an optional per-object array (zero-initialized by the
+// caller and kept between frames) that remembers which plane rejected the
+// object last time, so coherent scenes usually need a single plane test. It
+// holds a plane index on every path, so it may be shared between them.
+template<class T>
+void classify_spheres(const frustum_t<T>& f, const vec3_t<T>* centers, const T* radii, size_t count,
+                      cull_result* results, unsigned char* cache = nullptr) {
+    for (size_t i = 0; i < count; ++i) {
+        auto first = cache ? cache[i] % frustum_t<T>::PLANE_COUNT : 0;
+        auto result = CULL_INSIDE;
+
+        for (int j = 0; j < frustum_t<T>::PLANE_COUNT; ++j) {
+            auto p = (first + j) % frustum_t<T>::PLANE_COUNT;
+            auto d = dot(f.planes[p], centers[i]);
+
+            if (d < -radii[i]) {
+                result = CULL_OUTSIDE;
+
+                if (cache) {
+                    cache[i] = (unsigned char)p;
+                }
+
+                break;
+            }
+
+            if (d < radii[i]) {
+                result = CULL_INTERSECT;
+            }
+        }
+
+        results[i] = result;
+    }
+}
+
+// Box corners are read with byte strides, so they may live inside larger structs
+template<class T>
+void classify_boxes(const frustum_t<T>& f, const vec3_t<T>* mins, size_t minStride, const vec3_t<T>* maxs, size_t maxStride,
+                    size_t count, cull_result* results, unsigned char* cache = nullptr) {
+    auto lo = reinterpret_cast<const char*>(mins);
+    auto hi = reinterpret_cast<const char*>(maxs);
+
+    for (size_t i = 0; i < count; ++i, lo += minStride, hi += maxStride) {
+        auto& min = *reinterpret_cast<const vec3_t<T>*>(lo);
+        auto& max = *reinterpret_cast<const vec3_t<T>*>(hi);
+        auto first = cache ? cache[i] % frustum_t<T>::PLANE_COUNT : 0;
+        auto center = (min + max) * T(0.5);
+        auto extents = (max - min) * T(0.5);
+        auto result = CULL_INSIDE;
+
+        for (int j = 0; j < frustum_t<T>::PLANE_COUNT; ++j) {
+            auto p = (first + j) % frustum_t<T>::PLANE_COUNT;
+            auto d = dot(f.planes[p], center);
+            auto r = dot(abs(f.planes[p].normal), extents);
+
+            if (d < -r) {
+                result = CULL_OUTSIDE;
+
+                if (cache) {
+                    cache[i] = (unsigned char)p;
+                }
+
+                break;
+            }
+
+            if (d < r) {
+                result = CULL_INTERSECT;
+            }
+        }
+
+        results[i] = result;
+    }
+}
+
+template<class T>
+void classify_boxes(const frustum_t<T>& f, const vec3_t<T>* mins, const vec3_t<T>* maxs, size_t count,
+                    cull_result* results, unsigned char* cache = nullptr) {
+    classify_boxes(f, mins, sizeof(vec3_t<T>), maxs, sizeof(vec3_t<T>), count, results, cache);
+}
+
+template<class T>
+void classify_boxes(const frustum_t<T>& f, const aabb_t<T>* boxes, size_t count,
+                    cull_result* results, unsigned char* cache = nullptr) {
+    classify_boxes(f, &boxes->min, sizeof(aabb_t<T>), &boxes->max, sizeof(aabb_t<T>), count, results, cache);
+}
+
+#if defined(ZMATH_SIMD)
+// The six planes are transposed into two groups of four (the last two lanes of
+// the second group never reject), so every object is tested against four planes
+// per instruction. The group holding the cached plane is tested first, and the
+// first rejecting plane of a group is cached.
+struct frustum_simd_planes {
+    simd4f nx[2], ny[2], nz[2], d[2];
+    simd4f ax[2], ay[2], az[2];
+
+    explicit frustum_simd_planes(const frustum_t<float>& f) {
+        float p[4][8];
+
+        for (int i = 0; i < 8; ++i) {
+            auto valid = i < frustum_t<float>::PLANE_COUNT;
+            p[0][i] = valid ? f.planes[i].normal.x : 0;
+            p[1][i] = valid ? f.planes[i].normal.y : 0;
+            p[2][i] = valid ? f.planes[i].normal.z : 0;
+            p[3][i] = valid ? f.planes[i].dist : std::numeric_limits<float>::max();
+        }
+
+        for (int g = 0; g < 2; ++g) {
+            nx[g] = simd_load(&p[0][g * 4]);
+            ny[g] = simd_load(&p[1][g * 4]);
+            nz[g] = simd_load(&p[2][g * 4]);
+            d[g]  = simd_load(&p[3][g * 4]);
+            ax[g] = simd_max(nx[g], simd_sub(simd_zero(), nx[g]));
+            ay[g] = simd_max(ny[g], simd_sub(simd_zero(), ny[g]));
+            az[g] = simd_max(nz[g], simd_sub(simd_zero(), nz[g]));
+        }
+    }
+
+    // Signed distances from a point to the four planes of a group
+    simd4f distance(int g, simd4f x, simd4f y, simd4f z) const {
+        return simd_madd(x, nx[g], simd_madd(y, ny[g], simd_madd(z, nz[g], d[g])));
+    }
+
+    // Projected radii of a box with the given extents onto the four plane normals
+    simd4f radius(int g, simd4f ex, simd4f ey, simd4f ez) const {
+        return simd_madd(ex, ax[g], simd_madd(ey, ay[g], simd_mul(ez, az[g])));
+    }
+
+    // Group of a cached plane index, and the plane index of the lowest set lane
+    static int group(const unsigned char* cache, size_t i) {
+        return cache ? (cache[i] % frustum_t<float>::PLANE_COUNT) / 4 : 0;
+    }
+
+    static unsigned char plane(int g, int mask) {
+        auto lane = (mask & 1) ? 0 : (mask & 2) ? 1 : (mask & 4) ? 2 : 3;
+        return (unsigned char)(g * 4 + lane);
+    }
+};
+
+template<>
+inline void classify_spheres(const frustum_t<float>& f, const vec3_t<float>* centers, const float* radii, size_t count,
+                             cull_result* results, unsigned char* cache) {
+    frustum_simd_planes planes(f);
+    auto zero = simd_zero();
+
+    for (size_t i = 0; i < count; ++i) {
+        auto x = simd_splat(centers[i].x);
+        auto y = simd_splat(centers[i].y);
+        auto z = simd_splat(centers[i].z);
+        auto r = simd_splat(radii[i]);
+        auto first = frustum_simd_planes::group(cache, i);
+        auto result = CULL_INSIDE;
+
+        for (int j = 0; j < 2; ++j) {
+            auto g = first ^ j;
+            auto d = planes.distance(g, x, y, z);
+            auto outside = simd_mask(simd_cmplt(simd_add(d, r), zero));
+
+            if (outside) {
+                result = CULL_OUTSIDE;
+
+                if (cache) {
+                    cache[i] = frustum_simd_planes::plane(g, outside);
+                }
+
+                break;
+            }
+
+            if (simd_any(simd_cmplt(d, r))) {
+                result = CULL_INTERSECT;
+            }
+        }
+
+        results[i] = result;
+    }
+}
+
+template<>
+inline void classify_boxes(const frustum_t<float>& f, const vec3_t<float>* mins, size_t minStride, const vec3_t<float>* maxs, size_t maxStride,
+                           size_t count, cull_result* results, unsigned char* cache) {
+    frustum_simd_planes planes(f);
+    auto zero = simd_zero();
+    auto oneHalf = simd_splat(0.5f);
+    auto lo = reinterpret_cast<const char*>(mins);
+    auto hi = reinterpret_cast<const char*>(maxs);
+
+    for (size_t i = 0; i < count; ++i, lo += minStride, hi += maxStride) {
+        auto min = reinterpret_cast<const float*>(lo);
+        auto max = reinterpret_cast<const float*>(hi);
+        auto minX = simd_splat(min[0]), maxX = simd_splat(max[0]);
+        auto minY = simd_splat(min[1]), maxY = simd_splat(max[1]);
+        auto minZ = simd_splat(min[2]), maxZ = simd_splat(max[2]);
+        auto x = simd_mul(simd_add(minX, maxX), oneHalf);
+        auto y = simd_mul(simd_add(minY, maxY), oneHalf);
+        auto z = simd_mul(simd_add(minZ, maxZ), oneHalf);
+        auto ex = simd_mul(simd_sub(maxX, minX), oneHalf);
+        auto ey = simd_mul(simd_sub(maxY, minY), oneHalf);
+        auto ez = simd_mul(simd_sub(maxZ, minZ), oneHalf);
+        auto first = frustum_simd_planes::group(cache, i);
+        auto result = CULL_INSIDE;
+
+        for (int j = 0; j < 2; ++j) {
+            auto g = first ^ j;
+            auto d = planes.distance(g, x, y, z);
+            auto r = planes.radius(g, ex, ey, ez);
+            auto outside = simd_mask(simd_cmplt(simd_add(d, r), zero));
+
+            if (outside) {
+                result = CULL_OUTSIDE;
+
+                if (cache) {
+                    cache[i] = frustum_simd_planes::plane(g, outside);
+                }
+
+                break;
+            }
+
+            if (simd_any(simd_cmplt(d, r))) {
+                result = CULL_INTERSECT;
+            }
+        }
+
+        results[i] = result;
+    }
+}
+#endif
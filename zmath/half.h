@@ -0,0 +1,249 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+#include <cstring>
+
+// IEEE 754 binary16 conversions with round-to-nearest-even. Values beyond
+// 65504 become infinity and NaN stays NaN.
+inline unsigned short float_to_half(float f) {
+#if defined(ZMATH_SIMD_F16) && defined(ZMATH_SIMD_SSE)
+    return (unsigned short)_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT);
+#else
+    unsigned int bits;
+    memcpy(&bits, &f, sizeof(bits));
+
+    auto sign = (bits >> 16) & 0x8000;
+    auto a = bits & 0x7fffffff;
+
+    if (a > 0x7f800000) {
+        return (unsigned short)(sign | 0x7e00 | ((a >> 13) & 0x3ff));
+    }
+
+    if (a >= 0x477ff000) {
+        return (unsigned short)(sign | 0x7c00);
+    }
+
+    if (a >= 0x38800000) {
+        a -= (127 - 15) << 23;
+        return (unsigned short)(sign | ((a + 0xfff + ((a >> 13) & 1)) >> 13));
+    }
+
+    // Subnormal or zero, in units of 2^-24
+    auto shift = 126 - int(a >> 23);
+
+    if (shift > 24) {
+        return (unsigned short)sign;
+    }
+
+    auto mant = (a & 0x7fffff) | 0x800000;
+    auto value = mant >> shift;
+    auto rest = mant & ((1u << shift) - 1);
+    auto tie = 1u << (shift - 1);
+
+    if (rest > tie || (rest == tie && (value & 1))) {
+        ++value;
+    }
+
+    return (unsigned short)(sign | value);
+#endif
+}
+
+inline float half_to_float(unsigned short h) {
+#if defined(ZMATH_SIMD_F16) && defined(ZMATH_SIMD_SSE)
+    return _cvtsh_ss(h);
+#else
+    unsigned int sign = (h & 0x8000u) << 16;
+    unsigned int e = (h >> 10) & 31;
+    unsigned int m = h & 0x3ff;
+    unsigned int bits;
+
+    if (e == 31) {
+        bits = sign | 0x7f800000 | m << 13;
+    } else if (e != 0) {
+        bits = sign | (e + 127 - 15) << 23 | m << 13;
+    } else {
+        auto f = float(m) * (1.0f / 16777216.0f);
+        return sign ? -f : f;
+    }
+
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+#endif
+}
+
+// Storage type: converts to float for arithmetic and rounds back on
+// assignment, so vec3_t<half> and friends work as compact vertex and key
+// formats. Convert to the float types for anything beyond loads and stores.
+struct half {
+    unsigned short bits;
+
+    half() = default;
+    half(float f) : bits(float_to_half(f)) {}
+
+    operator float() const {
+        return half_to_float(bits);
+    }
+
+    half& operator += (float f) {
+        return *this = half(float(*this) + f);
+    }
+
+    half& operator -= (float f) {
+        return *this = half(float(*this) - f);
+    }
+
+    half& operator *= (float f) {
+        return *this = half(float(*this) * f);
+    }
+
+    half& operator /= (float f) {
+        return *this = half(float(*this) / f);
+    }
+
+    static half from_bits(unsigned short bits) {
+        half h;
+        h.bits = bits;
+        return h;
+    }
+};
+
+namespace std {
+template<>
+class numeric_limits<half> {
+public:
+    static const bool is_specialized = true;
+    static half min() { return half::from_bits(0x0400); }
+    static half max() { return half::from_bits(0x7bff); }
+    static half lowest() { return half::from_bits(0xfbff); }
+    static const int digits = 11;
+    static const int digits10 = 3;
+    static const int max_digits10 = 5;
+    static const bool is_signed = true;
+    static const bool is_integer = false;
+    static const bool is_exact = false;
+    static const int radix = 2;
+    static half epsilon() { return half::from_bits(0x1400); }
+    static half round_error() { return half::from_bits(0x3800); }
+    static const int min_exponent = -13;
+    static const int min_exponent10 = -4;
+    static const int max_exponent = 16;
+    static const int max_exponent10 = 4;
+    static const bool has_infinity = true;
+    static const bool has_quiet_NaN = true;
+    static const bool has_signaling_NaN = true;
+    static const float_denorm_style has_denorm = denorm_present;
+    static const bool has_denorm_loss = false;
+    static half infinity() { return half::from_bits(0x7c00); }
+    static half quiet_NaN() { return half::from_bits(0x7e00); }
+    static half signaling_NaN() { return half::from_bits(0x7d00); }
+    static half denorm_min() { return half::from_bits(0x0001); }
+    static const bool is_iec559 = true;
+    static const bool is_bounded = true;
+    static const bool is_modulo = false;
+    static const bool traps = false;
+    static const bool tinyness_before = false;
+    static const float_round_style round_style = round_to_nearest;
+};
+} // namespace std
+
+#if defined(ZMATH_SIMD_F16)
+#if defined(ZMATH_SIMD_SSE)
+inline simd4f simd_load_half(const half* p) {
+    return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+}
+
+inline void simd_store_half(half* p, simd4f v) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+}
+#else
+inline simd4f simd_load_half(const half* p) {
+    return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(&p->bits)));
+}
+
+inline void simd_store_half(half* p, simd4f v) {
+    vst1_u16(&p->bits, vreinterpret_u16_f16(vcvt_f16_f32(v)));
+}
+#endif
+#endif
+
+// Bulk conversions; out must not alias in
+inline void float_to_half(half* out, const float* in, size_t count) {
+    size_t i = 0;
+
+#if defined(ZMATH_SIMD_F16)
+    for (auto blocks = count / 4; i < blocks * 4; i += 4) {
+        simd_store_half(out + i, simd_load(in + i));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        out[i] = half(in[i]);
+    }
+}
+
+inline void half_to_float(float* out, const half* in, size_t count) {
+    size_t i = 0;
+
+#if defined(ZMATH_SIMD_F16)
+    for (auto blocks = count / 4; i < blocks * 4; i += 4) {
+        simd_store(out + i, simd_load_half(in + i));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        out[i] = float(in[i]);
+    }
+}
+
+inline void float_to_half(vec2_t<half>* out, const vec2_t<float>* in, size_t count) {
+    float_to_half(&out->x, &in->x, count * 2);
+}
+
+inline void half_to_float(vec2_t<float>* out, const vec2_t<half>* in, size_t count) {
+    half_to_float(&out->x, &in->x, count * 2);
+}
+
+inline void float_to_half(vec3_t<half>* out, const vec3_t<float>* in, size_t count) {
+    float_to_half(&out->x, &in->x, count * 3);
+}
+
+inline void half_to_float(vec3_t<float>* out, const vec3_t<half>* in, size_t count) {
+    half_to_float(&out->x, &in->x, count * 3);
+}
+
+inline void float_to_half(vec4_t<half>* out, const vec4_t<float>* in, size_t count) {
+    float_to_half(&out->x, &in->x, count * 4);
+}
+
+inline void half_to_float(vec4_t<float>* out, const vec4_t<half>* in, size_t count) {
+    half_to_float(&out->x, &in->x, count * 4);
+}
+
+inline void float_to_half(quat_t<half>* out, const quat_t<float>* in, size_t count) {
+    float_to_half(&out->x, &in->x, count * 4);
+}
+
+inline void half_to_float(quat_t<float>* out, const quat_t<half>* in, size_t count) {
+    half_to_float(&out->x, &in->x, count * 4);
+}
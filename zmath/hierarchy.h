@@ -0,0 +1,243 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+#include <vector>
+
+#if defined(ZMATH_THREADS)
+#include <atomic>
+#include <thread>
+#endif
+
+// Flat transform hierarchy. Nodes are stored depth-first, so every parent
+// precedes its children and the subtree of node i is the index range
+// [i, ends[i]). Locals are kept as translation, rotation and scale; world
+// matrices are rebuilt only for nodes whose local or an ancestor's local
+// changed, and clean subtrees are skipped as a whole.
+
+// a * b for affine matrices, including the translation of b
+template<class T>
+mat4x3_t<T> affine_multiply(const mat4x3_t<T>& a, const mat4x3_t<T>& b) {
+    return mat4x3_t<T>(a.m11 * b.m11 + a.m12 * b.m21 + a.m13 * b.m31,
+                       a.m11 * b.m12 + a.m12 * b.m22 + a.m13 * b.m32,
+                       a.m11 * b.m13 + a.m12 * b.m23 + a.m13 * b.m33,
+                       a.m21 * b.m11 + a.m22 * b.m21 + a.m23 * b.m31,
+                       a.m21 * b.m12 + a.m22 * b.m22 + a.m23 * b.m32,
+                       a.m21 * b.m13 + a.m22 * b.m23 + a.m23 * b.m33,
+                       a.m31 * b.m11 + a.m32 * b.m21 + a.m33 * b.m31,
+                       a.m31 * b.m12 + a.m32 * b.m22 + a.m33 * b.m32,
+                       a.m31 * b.m13 + a.m32 * b.m23 + a.m33 * b.m33,
+                       a.m41 * b.m11 + a.m42 * b.m21 + a.m43 * b.m31 + b.m41,
+                       a.m41 * b.m12 + a.m42 * b.m22 + a.m43 * b.m32 + b.m42,
+                       a.m41 * b.m13 + a.m42 * b.m23 + a.m43 * b.m33 + b.m43);
+}
+
+template<class T>
+struct hierarchy_t {
+    enum {
+        DIRTY_LOCAL   = 1, // local changed, the whole subtree needs updating
+        DIRTY_SUBTREE = 2, // some descendant has DIRTY_LOCAL set
+        PARALLEL_MIN_NODES = 1024,
+    };
+
+    std::vector<int> parents; // -1 for roots
+    std::vector<int> ends;    // one past the last node of the subtree
+    std::vector<vec3_t<T>> translations;
+    std::vector<quat_t<T>> rotations;
+    std::vector<vec3_t<T>> scales;
+    std::vector<mat4x3_t<T>> worlds;
+    std::vector<unsigned char> flags;
+
+    size_t size() const {
+        return parents.size();
+    }
+
+    // Appends a node and returns its index. To keep the depth-first order the
+    // parent must be -1 or the previously added node or one of its ancestors.
+    int add(int parent, const vec3_t<T>& translation, const quat_t<T>& rotation,
+            const vec3_t<T>& scale = vec3_t<T>(1, 1, 1)) {
+        int index = (int)parents.size();
+#if !defined(NDEBUG)
+        auto a = index - 1;
+        while (a >= 0 && a != parent) {
+            a = parents[a];
+        }
+        assert(a == parent);
+#endif
+
+        parents.push_back(parent);
+        ends.push_back(index + 1);
+        translations.push_back(translation);
+        rotations.push_back(rotation);
+        scales.push_back(scale);
+        worlds.push_back(mat4x3_t<T>::identity());
+        flags.push_back(0);
+
+        for (auto p = parent; p >= 0; p = parents[p]) {
+            ends[p] = index + 1;
+        }
+
+        mark(index);
+        return index;
+    }
+
+    void clear() {
+        parents.clear();
+        ends.clear();
+        translations.clear();
+        rotations.clear();
+        scales.clear();
+        worlds.clear();
+        flags.clear();
+    }
+
+    void set_local(int i, const vec3_t<T>& translation, const quat_t<T>& rotation, const vec3_t<T>& scale) {
+        translations[i] = translation;
+        rotations[i] = rotation;
+        scales[i] = scale;
+        mark(i);
+    }
+
+    void set_translation(int i, const vec3_t<T>& translation) {
+        translations[i] = translation;
+        mark(i);
+    }
+
+    void set_rotation(int i, const quat_t<T>& rotation) {
+        rotations[i] = rotation;
+        mark(i);
+    }
+
+    void set_scale(int i, const vec3_t<T>& scale) {
+        scales[i] = scale;
+        mark(i);
+    }
+
+    // Flags node i for update; call after writing the local arrays directly
+    void mark(int i) {
+        flags[i] |= DIRTY_LOCAL;
+
+        for (auto p = parents[i]; p >= 0 && !(flags[p] & DIRTY_SUBTREE); p = parents[p]) {
+            flags[p] |= DIRTY_SUBTREE;
+        }
+    }
+
+    mat4x3_t<T> local(int i) const {
+        mat4x3_t<T> m(rotations[i], translations[i]);
+        auto& s = scales[i];
+        m.m11 *= s.x; m.m12 *= s.x; m.m13 *= s.x;
+        m.m21 *= s.y; m.m22 *= s.y; m.m23 *= s.y;
+        m.m31 *= s.z; m.m32 *= s.z; m.m33 *= s.z;
+        return m;
+    }
+
+    void update() {
+        update_range(0, (int)size());
+    }
+
+    // With ZMATH_THREADS defined, updates the children of each root
+    // concurrently on up to threads threads, 0 meaning one per hardware
+    // thread; small hierarchies are updated on the calling thread. Without it
+    // this is update().
+    void update(unsigned threads) {
+#if defined(ZMATH_THREADS)
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+
+        if (threads <= 1 || size() < PARALLEL_MIN_NODES) {
+            update();
+            return;
+        }
+
+        // Roots go first, their child subtrees are independent tasks
+        std::vector<std::pair<int, int>> tasks;
+
+        for (int r = 0; r < (int)size(); r = ends[r]) {
+            if (flags[r] & DIRTY_LOCAL) {
+                worlds[r] = local(r);
+
+                for (auto c = r + 1; c < ends[r]; c = ends[c]) {
+                    flags[c] |= DIRTY_LOCAL;
+                }
+            } else if (!(flags[r] & DIRTY_SUBTREE)) {
+                continue;
+            }
+
+            flags[r] = 0;
+
+            for (auto c = r + 1; c < ends[r]; c = ends[c]) {
+                if (flags[c]) {
+                    tasks.push_back(std::make_pair(c, ends[c]));
+                }
+            }
+        }
+
+        std::atomic<size_t> next(0);
+        auto worker = [this, &tasks, &next]() {
+            for (size_t t; (t = next++) < tasks.size();) {
+                update_range(tasks[t].first, tasks[t].second);
+            }
+        };
+
+        if (threads > tasks.size()) {
+            threads = (unsigned)tasks.size();
+        }
+
+        std::vector<std::thread> pool;
+        for (unsigned i = 1; i < threads; ++i) {
+            pool.push_back(std::thread(worker));
+        }
+
+        worker();
+
+        for (auto& t : pool) {
+            t.join();
+        }
+#else
+        (void)threads;
+        update();
+#endif
+    }
+
+    void update_node(int i) {
+        auto p = parents[i];
+        worlds[i] = (p >= 0) ? affine_multiply(local(i), worlds[p]) : local(i);
+        flags[i] = 0;
+    }
+
+    void update_range(int begin, int end) {
+        for (auto i = begin; i < end;) {
+            if (flags[i] & DIRTY_LOCAL) {
+                for (auto j = i; j < ends[i]; ++j) {
+                    update_node(j);
+                }
+                i = ends[i];
+            } else if (flags[i] & DIRTY_SUBTREE) {
+                flags[i] = 0;
+                ++i;
+            } else {
+                i = ends[i];
+            }
+        }
+    }
+};
@@ -34,37 +34,45 @@ struct mat2x2_t {
 
     // Constructors
     mat2x2_t() {}
-    mat2x2_t(T m11, T m12,
-             T m21, T m22) :
+    ZMATH_CONSTEXPR mat2x2_t(T m11, T m12,
+                             T m21, T m22) :
         m11(m11), m12(m12),
         m21(m21), m22(m22) {}
-    explicit mat2x2_t(const mat3x3_t<T>& mat) :
+    explicit ZMATH_CONSTEXPR mat2x2_t(const mat3x3_t<T>& mat) :
         m11(mat.m11), m12(mat.m12),
         m21(mat.m21), m22(mat.m22) {}
-    explicit mat2x2_t(const T* p) :
+    explicit ZMATH_CONSTEXPR mat2x2_t(const T* p) :
         m11(p[0]), m12(p[1]),
         m21(p[2]), m22(p[3]) {}
+    template<class U>
+    explicit ZMATH_CONSTEXPR mat2x2_t(const mat2x2_t<U>& m) :
+        m11(T(m.m11)), m12(T(m.m12)),
+        m21(T(m.m21)), m22(T(m.m22)) {}
 
     // Unary operators
-    mat2x2_t operator - () const {
+    ZMATH_CONSTEXPR mat2x2_t operator - () const {
         return mat2x2_t(-m11, -m12,
                         -m21, -m22);
     }
 
+    // Only a singular matrix asserts, see mat3x3_t
     mat2x2_t operator ! () const {
         auto det = determinant();
-        assert(fabs(det) > std::numeric_limits<T>::epsilon());
-        return mat2x2_t( m22 / det, -m12 / det,
-                        -m21 / det,  m11 / det);
+        assert(det != 0);
+        auto inv = T(1) / det;
+        using std::isfinite;
+        assert(isfinite(inv));
+        return mat2x2_t( m22 * inv, -m12 * inv,
+                        -m21 * inv,  m11 * inv);
     }
 
     // Binary operators
-    mat2x2_t operator * (T f) const {
+    ZMATH_CONSTEXPR mat2x2_t operator * (T f) const {
         return mat2x2_t(m11 * f, m12 * f,
                         m21 * f, m22 * f);
     }
 
-    friend mat2x2_t operator * (T f, const mat2x2_t& mat) {
+    friend ZMATH_CONSTEXPR mat2x2_t operator * (T f, const mat2x2_t& mat) {
         return mat2x2_t(mat.m11 * f, mat.m12 * f,
                         mat.m21 * f, mat.m22 * f);
     }
@@ -75,12 +83,12 @@ struct mat2x2_t {
                         m21 / f, m22 / f);
     }
 
-    mat2x2_t operator + (const mat2x2_t& mat) const {
+    ZMATH_CONSTEXPR mat2x2_t operator + (const mat2x2_t& mat) const {
         return mat2x2_t(m11 + mat.m11, m12 + mat.m12,
                         m21 + mat.m21, m22 + mat.m22);
     }
 
-    mat2x2_t operator - (const mat2x2_t& mat) const {
+    ZMATH_CONSTEXPR mat2x2_t operator - (const mat2x2_t& mat) const {
         return mat2x2_t(m11 - mat.m11, m12 - mat.m12,
                         m21 - mat.m21, m22 - mat.m22);
     }
@@ -208,42 +216,42 @@ struct mat2x2_t {
         return vec2_t<T>(m[0][index], m[1][index]);
     }
 
-    T determinant() const {
+    ZMATH_CONSTEXPR T determinant() const {
         return det2x2(m11, m12,
                       m21, m22);
     }
 
-    static mat2x2_t identity() {
+    static ZMATH_CONSTEXPR mat2x2_t identity() {
         return mat2x2_t(1, 0,
                         0, 1);
     }
 
-    static mat2x2_t zero() {
+    static ZMATH_CONSTEXPR mat2x2_t zero() {
         return mat2x2_t(0, 0,
                         0, 0);
     }
 
     static mat2x2_t rotation(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
 
         return mat2x2_t( cosAngle, sinAngle,
                         -sinAngle, cosAngle);
     }
 
-    static mat2x2_t scale(T sx, T sy) {
+    static ZMATH_CONSTEXPR mat2x2_t scale(T sx, T sy) {
         return mat2x2_t(sx, 0,
                         0,  sy);
     }
 
-    static mat2x2_t scale(const vec2_t<T>& s) {
+    static ZMATH_CONSTEXPR mat2x2_t scale(const vec2_t<T>& s) {
         return mat2x2_t(s.x, 0,
                         0,   s.y);
     }
 };
 
 template<class T>
-mat2x2_t<T> transpose(const mat2x2_t<T>& mat) {
+ZMATH_CONSTEXPR mat2x2_t<T> transpose(const mat2x2_t<T>& mat) {
     return mat2x2_t<T>(mat.m11, mat.m21,
                        mat.m12, mat.m22);
 }
@@ -35,55 +35,65 @@ struct mat3x3_t {
 
     // Constructors
     mat3x3_t() {}
-    mat3x3_t(T m11, T m12, T m13,
-             T m21, T m22, T m23,
-             T m31, T m32, T m33) :
+    ZMATH_CONSTEXPR mat3x3_t(T m11, T m12, T m13,
+                             T m21, T m22, T m23,
+                             T m31, T m32, T m33) :
         m11(m11), m12(m12), m13(m13),
         m21(m21), m22(m22), m23(m23),
         m31(m31), m32(m32), m33(m33) {}
-    explicit mat3x3_t(const mat2x2_t<T>& mat) :
+    explicit ZMATH_CONSTEXPR mat3x3_t(const mat2x2_t<T>& mat) :
         m11(mat.m11), m12(mat.m12), m13(0),
         m21(mat.m21), m22(mat.m22), m23(0),
         m31(0),       m32(0),       m33(0) {}
-    explicit mat3x3_t(const mat4x4_t<T>& mat) :
+    explicit ZMATH_CONSTEXPR mat3x3_t(const mat4x4_t<T>& mat) :
         m11(mat.m11), m12(mat.m12), m13(mat.m13),
         m21(mat.m21), m22(mat.m22), m23(mat.m23),
         m31(mat.m31), m32(mat.m32), m33(mat.m33) {}
-    explicit mat3x3_t(const quat_t<T>& q) :
+    explicit ZMATH_CONSTEXPR mat3x3_t(const quat_t<T>& q) :
         m11(1 - 2 * (q.y * q.y + q.z * q.z)), m12(2 * (q.x * q.y - q.z * q.w)),     m13(2 * (q.x * q.z + q.y * q.w)),
         m21(2 * (q.x * q.y + q.z * q.w)),     m22(1 - 2 * (q.x * q.x + q.z * q.z)), m23(2 * (q.y * q.z - q.x * q.w)),
         m31(2 * (q.x * q.z - q.y * q.w)),     m32(2 * (q.y * q.z + q.x * q.w)),     m33(1 - 2 * (q.x * q.x + q.y * q.y)) {}
-    explicit mat3x3_t(const T* p) :
+    explicit ZMATH_CONSTEXPR mat3x3_t(const T* p) :
         m11(p[0]), m12(p[1]), m13(p[2]),
         m21(p[3]), m22(p[4]), m23(p[5]),
         m31(p[6]), m32(p[7]), m33(p[8]) {}
+    template<class U>
+    explicit ZMATH_CONSTEXPR mat3x3_t(const mat3x3_t<U>& m) :
+        m11(T(m.m11)), m12(T(m.m12)), m13(T(m.m13)),
+        m21(T(m.m21)), m22(T(m.m22)), m23(T(m.m23)),
+        m31(T(m.m31)), m32(T(m.m32)), m33(T(m.m33)) {}
 
     // Unary operators
-    mat3x3_t operator - () const {
+    ZMATH_CONSTEXPR mat3x3_t operator - () const {
         return mat3x3_t(-m11, -m12, -m13,
                         -m21, -m22, -m23,
                         -m31, -m32, -m33);
     }
 
+    // Only a singular matrix asserts (det zero or 1 / det not finite), so
+    // uniformly scaled matrices invert at any scale, as with mat4x4_t.
     mat3x3_t operator ! () const {
         auto c11 =  det2x2(m22, m23, m32, m33);
         auto c12 = -det2x2(m12, m13, m32, m33);
         auto c13 =  det2x2(m12, m13, m22, m23);
         auto det = m11 * c11 + m21 * c12 + m31 * c13;
-        assert(fabs(det) > std::numeric_limits<T>::epsilon());
-        return mat3x3_t( c11 / det,                         c12 / det,                         c13 / det,
-                        -det2x2(m21, m23, m31, m33) / det,  det2x2(m11, m13, m31, m33) / det, -det2x2(m11, m13, m21, m23) / det,
-                         det2x2(m21, m22, m31, m32) / det, -det2x2(m11, m12, m31, m32) / det,  det2x2(m11, m12, m21, m22) / det);
+        assert(det != 0);
+        auto inv = T(1) / det;
+        using std::isfinite;
+        assert(isfinite(inv));
+        return mat3x3_t( c11 * inv,                         c12 * inv,                         c13 * inv,
+                        -det2x2(m21, m23, m31, m33) * inv,  det2x2(m11, m13, m31, m33) * inv, -det2x2(m11, m13, m21, m23) * inv,
+                         det2x2(m21, m22, m31, m32) * inv, -det2x2(m11, m12, m31, m32) * inv,  det2x2(m11, m12, m21, m22) * inv);
     }
 
     // Binary operators
-    mat3x3_t operator * (T f) const {
+    ZMATH_CONSTEXPR mat3x3_t operator * (T f) const {
         return mat3x3_t(m11 * f, m12 * f, m13 * f,
                         m21 * f, m22 * f, m23 * f,
                         m31 * f, m32 * f, m33 * f);
     }
 
-    friend mat3x3_t operator * (T f, const mat3x3_t& mat) {
+    friend ZMATH_CONSTEXPR mat3x3_t operator * (T f, const mat3x3_t& mat) {
         return mat3x3_t(mat.m11 * f, mat.m12 * f, mat.m13 * f,
                         mat.m21 * f, mat.m22 * f, mat.m23 * f,
                         mat.m31 * f, mat.m32 * f, mat.m33 * f);
@@ -96,13 +106,13 @@ struct mat3x3_t {
                         m31 / f, m32 / f, m33 / f);
     }
 
-    mat3x3_t operator + (const mat3x3_t& mat) const {
+    ZMATH_CONSTEXPR mat3x3_t operator + (const mat3x3_t& mat) const {
         return mat3x3_t(m11 + mat.m11, m12 + mat.m12, m13 + mat.m13,
                         m21 + mat.m21, m22 + mat.m22, m23 + mat.m23,
                         m31 + mat.m31, m32 + mat.m32, m33 + mat.m33);
     }
 
-    mat3x3_t operator - (const mat3x3_t& mat) const {
+    ZMATH_CONSTEXPR mat3x3_t operator - (const mat3x3_t& mat) const {
         return mat3x3_t(m11 - mat.m11, m12 - mat.m12, m13 - mat.m13,
                         m21 - mat.m21, m22 - mat.m22, m23 - mat.m23,
                         m31 - mat.m31, m32 - mat.m32, m33 - mat.m33);
@@ -231,27 +241,27 @@ struct mat3x3_t {
         return vec3_t<T>(m[0][index], m[1][index], m[2][index]);
     }
 
-    T determinant() const {
+    ZMATH_CONSTEXPR T determinant() const {
         return det3x3(m11, m12, m13,
                       m21, m22, m23,
                       m31, m32, m33);
     }
 
-    static mat3x3_t identity() {
+    static ZMATH_CONSTEXPR mat3x3_t identity() {
         return mat3x3_t(1, 0, 0,
                         0, 1, 0,
                         0, 0, 1);
     }
 
-    static mat3x3_t zero() {
+    static ZMATH_CONSTEXPR mat3x3_t zero() {
         return mat3x3_t(0, 0, 0,
                         0, 0, 0,
                         0, 0, 0);
     }
 
     static mat3x3_t rotation(const vec3_t<T>& axis, T angle) {
-        auto ca = cos(angle);
-        auto sa = sin(angle);
+        T sa, ca;
+        sincos(angle, sa, ca);
         auto dir = normalize(axis);
         auto g = 1 - ca;
         return mat3x3_t(dir.x * dir.x * g + ca,         dir.x * dir.y * g - dir.z * sa, dir.x * dir.z * g + dir.y * sa,
@@ -260,12 +270,10 @@ struct mat3x3_t {
     }
 
     static mat3x3_t rotation(T pitch, T yaw, T roll) {
-        auto sx = sin(pitch);
-        auto cx = cos(pitch);
-        auto sy = sin(yaw);
-        auto cy = cos(yaw);
-        auto sz = sin(roll);
-        auto cz = cos(roll);
+        T sx, cx, sy, cy, sz, cz;
+        sincos(pitch, sx, cx);
+        sincos(yaw, sy, cy);
+        sincos(roll, sz, cz);
         auto c1 =  cy * -sz;
         auto c2 = -sy * -sz;
         return mat3x3_t( cy *  cz, (c1 *  cx) + (sy * sx), (c1 * -sx) + (sy * cx),
@@ -274,66 +282,66 @@ struct mat3x3_t {
     }
 
     static mat3x3_t rotationX(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
         return mat3x3_t(1,  0,        0,
                         0,  cosAngle, sinAngle,
                         0, -sinAngle, cosAngle);
     }
 
     static mat3x3_t rotationY(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
         return mat3x3_t(cosAngle, 0, -sinAngle,
                         0,        1,  0,
                         sinAngle, 0,  cosAngle);
     }
 
     static mat3x3_t rotationZ(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
         return mat3x3_t( cosAngle, sinAngle, 0,
                         -sinAngle, cosAngle, 0,
                          0,        0,        1);
     }
 
-    static mat3x3_t translation(T dx, T dy) {
+    static ZMATH_CONSTEXPR mat3x3_t translation(T dx, T dy) {
         return mat3x3_t(1,  0,  0,
                         0,  1,  0,
                         dx, dy, 1);
     }
 
-    static mat3x3_t translation(const vec2_t<T>& t) {
+    static ZMATH_CONSTEXPR mat3x3_t translation(const vec2_t<T>& t) {
         return mat3x3_t(1,   0,   0,
                         0,   1,   0,
                         t.x, t.y, 1);
     }
 
-    static mat3x3_t scale(T s) {
+    static ZMATH_CONSTEXPR mat3x3_t scale(T s) {
         return mat3x3_t(s, 0, 0,
                         0, s, 0,
                         0, 0, 1);
     }
 
-    static mat3x3_t scale(T sx, T sy) {
+    static ZMATH_CONSTEXPR mat3x3_t scale(T sx, T sy) {
         return mat3x3_t(sx, 0,  0,
                         0,  sy, 0,
                         0,  0,  1);
     }
 
-    static mat3x3_t scale(T sx, T sy, T sz) {
+    static ZMATH_CONSTEXPR mat3x3_t scale(T sx, T sy, T sz) {
         return mat3x3_t(sx, 0,  0,
                         0,  sy, 0,
                         0,  0,  sz);
     }
 
-    static mat3x3_t scale(const vec2_t<T>& s) {
+    static ZMATH_CONSTEXPR mat3x3_t scale(const vec2_t<T>& s) {
         return mat3x3_t(s.x, 0,   0,
                         0,   s.y, 0,
                         0,   0,   1);
     }
 
-    static mat3x3_t scale(const vec3_t<T>& s) {
+    static ZMATH_CONSTEXPR mat3x3_t scale(const vec3_t<T>& s) {
         return mat3x3_t(s.x, 0,   0,
                         0,   s.y, 0,
                         0,   0,   s.z);
@@ -341,7 +349,7 @@ struct mat3x3_t {
 };
 
 template<class T>
-mat3x3_t<T> transpose(const mat3x3_t<T>& mat) {
+ZMATH_CONSTEXPR mat3x3_t<T> transpose(const mat3x3_t<T>& mat) {
     return mat3x3_t<T>(mat.m11, mat.m21, mat.m31,
                        mat.m12, mat.m22, mat.m32,
                        mat.m13, mat.m23, mat.m33);
@@ -36,37 +36,45 @@ struct mat4x3_t {
 
     // Constructors
     mat4x3_t() {}
-    mat4x3_t(T m11, T m12, T m13,
-             T m21, T m22, T m23,
-             T m31, T m32, T m33,
-             T m41, T m42, T m43) :
+    ZMATH_CONSTEXPR mat4x3_t(T m11, T m12, T m13,
+                             T m21, T m22, T m23,
+                             T m31, T m32, T m33,
+                             T m41, T m42, T m43) :
         m11(m11), m12(m12), m13(m13),
         m21(m21), m22(m22), m23(m23),
         m31(m31), m32(m32), m33(m33),
         m41(m41), m42(m42), m43(m43) {}
-    explicit mat4x3_t(const mat3x3_t<T>& mat) :
+    explicit ZMATH_CONSTEXPR mat4x3_t(const mat3x3_t<T>& mat) :
         m11(mat.m11), m12(mat.m12), m13(mat.m13),
         m21(mat.m21), m22(mat.m22), m23(mat.m23),
         m31(mat.m31), m32(mat.m32), m33(mat.m33),
         m41(0),       m42(0),       m43(0) {}
-    explicit mat4x3_t(const quat_t<T>& q) :
+    explicit ZMATH_CONSTEXPR mat4x3_t(const quat_t<T>& q) :
         m11(1 - 2 * (q.y * q.y + q.z * q.z)), m12(2 * (q.x * q.y - q.z * q.w)),     m13(2 * (q.x * q.z + q.y * q.w)),
         m21(2 * (q.x * q.y + q.z * q.w)),     m22(1 - 2 * (q.x * q.x + q.z * q.z)), m23(2 * (q.y * q.z - q.x * q.w)),
         m31(2 * (q.x * q.z - q.y * q.w)),     m32(2 * (q.y * q.z + q.x * q.w)),     m33(1 - 2 * (q.x * q.x + q.y * q.y)),
         m41(0),                               m42(0),                               m43(0) {}
-    mat4x3_t(const quat_t<T>& q, const vec3_t<T>& pos) :
+    ZMATH_CONSTEXPR mat4x3_t(const quat_t<T>& q, const vec3_t<T>& pos) :
         m11(1 - 2 * (q.y * q.y + q.z * q.z)), m12(2 * (q.x * q.y - q.z * q.w)),     m13(2 * (q.x * q.z + q.y * q.w)),
         m21(2 * (q.x * q.y + q.z * q.w)),     m22(1 - 2 * (q.x * q.x + q.z * q.z)), m23(2 * (q.y * q.z - q.x * q.w)),
         m31(2 * (q.x * q.z - q.y * q.w)),     m32(2 * (q.y * q.z + q.x * q.w)),     m33(1 - 2 * (q.x * q.x + q.y * q.y)),
         m41(pos.x),                           m42(pos.y),                           m43(pos.z) {}
-    explicit mat4x3_t(const T* p) :
+    explicit mat4x3_t(const dualquat_t<T>& dq) : mat4x3_t(dq.real, dq.translation()) {}
+
+    explicit ZMATH_CONSTEXPR mat4x3_t(const T* p) :
         m11(p[0]), m12(p[1]),  m13(p[2]),
         m21(p[3]), m22(p[4]),  m23(p[5]),
         m31(p[6]), m32(p[7]),  m33(p[8]),
         m41(p[9]), m42(p[10]), m43(p[11]) {}
+    template<class U>
+    explicit ZMATH_CONSTEXPR mat4x3_t(const mat4x3_t<U>& m) :
+        m11(T(m.m11)), m12(T(m.m12)), m13(T(m.m13)),
+        m21(T(m.m21)), m22(T(m.m22)), m23(T(m.m23)),
+        m31(T(m.m31)), m32(T(m.m32)), m33(T(m.m33)),
+        m41(T(m.m41)), m42(T(m.m42)), m43(T(m.m43)) {}
 
     // Unary operators
-    mat4x3_t operator - () const {
+    ZMATH_CONSTEXPR mat4x3_t operator - () const {
         return mat4x3_t(-m11, -m12, -m13,
                         -m21, -m22, -m23,
                         -m31, -m32, -m33,
@@ -74,14 +82,14 @@ struct mat4x3_t {
     }
 
     // Binary operators
-    mat4x3_t operator + (const mat4x3_t& mat) const {
+    ZMATH_CONSTEXPR mat4x3_t operator + (const mat4x3_t& mat) const {
         return mat4x3_t(m11 + mat.m11, m12 + mat.m12, m13 + mat.m13,
                         m21 + mat.m21, m22 + mat.m22, m23 + mat.m23,
                         m31 + mat.m31, m32 + mat.m32, m33 + mat.m33,
                         m41 + mat.m41, m42 + mat.m42, m43 + mat.m43);
     }
 
-    mat4x3_t operator - (const mat4x3_t& mat) const {
+    ZMATH_CONSTEXPR mat4x3_t operator - (const mat4x3_t& mat) const {
         return mat4x3_t(m11 - mat.m11, m12 - mat.m12, m13 - mat.m13,
                         m21 - mat.m21, m22 - mat.m22, m23 - mat.m23,
                         m31 - mat.m31, m32 - mat.m32, m33 - mat.m33,
@@ -104,14 +112,14 @@ struct mat4x3_t {
         return tmp;
     }
 
-    mat4x3_t operator * (T f) const {
+    ZMATH_CONSTEXPR mat4x3_t operator * (T f) const {
         return mat4x3_t(m11 * f, m12 * f, m13 * f,
                         m21 * f, m22 * f, m23 * f,
                         m31 * f, m32 * f, m33 * f,
                         m41 * f, m42 * f, m43 * f);
     }
 
-    friend mat4x3_t operator * (T f, const mat4x3_t& mat) {
+    friend ZMATH_CONSTEXPR mat4x3_t operator * (T f, const mat4x3_t& mat) {
         return mat4x3_t(mat.m11 * f, mat.m12 * f, mat.m13 * f,
                         mat.m21 * f, mat.m22 * f, mat.m23 * f,
                         mat.m31 * f, mat.m32 * f, mat.m33 * f,
@@ -233,14 +241,14 @@ struct mat4x3_t {
         return vec4_t<T>(m[0][index], m[1][index], m[2][index], m[3][index]);
     }
 
-    static mat4x3_t identity() {
+    static ZMATH_CONSTEXPR mat4x3_t identity() {
         return mat4x3_t(1, 0, 0,
                         0, 1, 0,
                         0, 0, 1,
                         0, 0, 0);
     }
 
-    static mat4x3_t zero() {
+    static ZMATH_CONSTEXPR mat4x3_t zero() {
         return mat4x3_t(0, 0, 0,
                         0, 0, 0,
                         0, 0, 0,
@@ -248,8 +256,8 @@ struct mat4x3_t {
     }
 
     static mat4x3_t rotation(const vec3_t<T>& axis, T angle) {
-        auto ca = cos(angle);
-        auto sa = sin(angle);
+        T sa, ca;
+        sincos(angle, sa, ca);
         auto dir = normalize(axis);
         auto g = 1 - ca;
         return mat4x3_t(dir.x * dir.x * g + ca,         dir.x * dir.y * g - dir.z * sa, dir.x * dir.z * g + dir.y * sa,
@@ -259,12 +267,10 @@ struct mat4x3_t {
     }
 
     static mat4x3_t rotation(T pitch, T yaw, T roll) {
-        auto sx = sin(pitch);
-        auto cx = cos(pitch);
-        auto sy = sin(yaw);
-        auto cy = cos(yaw);
-        auto sz = sin(roll);
-        auto cz = cos(roll);
+        T sx, cx, sy, cy, sz, cz;
+        sincos(pitch, sx, cx);
+        sincos(yaw, sy, cy);
+        sincos(roll, sz, cz);
         auto c1 = cy * -sz;
         auto c2 = sy *  sz;
         return mat4x3_t( cy * cz, (c1 * cx) + (sy * sx), (c1 * -sx) + (sy * cx),
@@ -274,8 +280,8 @@ struct mat4x3_t {
     }
 
     static mat4x3_t rotationX(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
         return mat4x3_t(1,  0,        0,
                         0,  cosAngle, sinAngle,
                         0, -sinAngle, cosAngle,
@@ -283,8 +289,8 @@ struct mat4x3_t {
     }
 
     static mat4x3_t rotationY(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
         return mat4x3_t(cosAngle, 0, -sinAngle,
                         0,        1,  0,
                         sinAngle, 0,  cosAngle,
@@ -292,46 +298,68 @@ struct mat4x3_t {
     }
 
     static mat4x3_t rotationZ(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
         return mat4x3_t( cosAngle, sinAngle, 0,
                         -sinAngle, cosAngle, 0,
                          0,        0,        1,
                          0,        0,        0);
     }
 
-    static mat4x3_t translation(T dx, T dy, T dz) {
+    static ZMATH_CONSTEXPR mat4x3_t translation(T dx, T dy, T dz) {
         return mat4x3_t(1,  0,  0,
                         0,  1,  0,
                         0,  0,  1,
                         dx, dy, dz);
     }
 
-    static mat4x3_t translation(const vec3_t<T>& t) {
+    static ZMATH_CONSTEXPR mat4x3_t translation(const vec3_t<T>& t) {
         return mat4x3_t(1,   0,   0,
                         0,   1,   0,
                         0,   0,   1,
                         t.x, t.y, t.z);
     }
 
-    static mat4x3_t scale(T s) {
+    static ZMATH_CONSTEXPR mat4x3_t scale(T s) {
         return mat4x3_t(s,  0, 0,
                         0,  s, 0,
                         0,  0, s,
                         0,  0, 0);
     }
 
-    static mat4x3_t scale(T sx, T sy, T sz) {
+    static ZMATH_CONSTEXPR mat4x3_t scale(T sx, T sy, T sz) {
         return mat4x3_t(sx,  0,  0,
                         0,  sy,  0,
                         0,   0, sz,
                         0,   0,  0);
     }
 
-    static mat4x3_t scale(const vec3_t<T>& s) {
+    static ZMATH_CONSTEXPR mat4x3_t scale(const vec3_t<T>& s) {
         return mat4x3_t(s.x, 0,   0,
                         0,   s.y, 0,
                         0,   0,   s.z,
                         0,   0,   0  );
     }
 };
+
+template<class T>
+mat4x3_t<T> inverse_affine(const mat4x3_t<T>& mat) {
+    auto r = !mat3x3_t<T>(mat.m11, mat.m12, mat.m13,
+                          mat.m21, mat.m22, mat.m23,
+                          mat.m31, mat.m32, mat.m33);
+    auto t = -(vec3_t<T>(mat.m41, mat.m42, mat.m43) * r);
+    return mat4x3_t<T>(r.m11, r.m12, r.m13,
+                       r.m21, r.m22, r.m23,
+                       r.m31, r.m32, r.m33,
+                       t.x,   t.y,   t.z);
+}
+
+// The 3x3 part must be orthonormal (rotation only)
+template<class T>
+mat4x3_t<T> inverse_rigid(const mat4x3_t<T>& mat) {
+    auto t = vec3_t<T>(mat.m41, mat.m42, mat.m43);
+    return mat4x3_t<T>( mat.m11,            mat.m21,            mat.m31,
+                        mat.m12,            mat.m22,            mat.m32,
+                        mat.m13,            mat.m23,            mat.m33,
+                       -dot(t, mat.row(0)), -dot(t, mat.row(1)), -dot(t, mat.row(2)));
+}
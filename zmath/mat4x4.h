@@ -36,65 +36,68 @@ struct mat4x4_t {
 
     // Constructors
     mat4x4_t() {}
-    mat4x4_t(T m11, T m12, T m13, T m14,
-             T m21, T m22, T m23, T m24,
-             T m31, T m32, T m33, T m34,
-             T m41, T m42, T m43, T m44) :
+    ZMATH_CONSTEXPR mat4x4_t(T m11, T m12, T m13, T m14,
+                             T m21, T m22, T m23, T m24,
+                             T m31, T m32, T m33, T m34,
+                             T m41, T m42, T m43, T m44) :
         m11(m11), m12(m12), m13(m13), m14(m14),
         m21(m21), m22(m22), m23(m23), m24(m24),
         m31(m31), m32(m32), m33(m33), m34(m34),
         m41(m41), m42(m42), m43(m43), m44(m44) {}
-    explicit mat4x4_t(const mat3x3_t<T>& mat) :
+    explicit ZMATH_CONSTEXPR mat4x4_t(const mat3x3_t<T>& mat) :
         m11(mat.m11), m12(mat.m12), m13(mat.m13), m14(0),
         m21(mat.m21), m22(mat.m22), m23(mat.m23), m24(0),
         m31(mat.m31), m32(mat.m32), m33(mat.m33), m34(0),
         m41(0),       m42(0),       m43(0),       m44(0) {}
-    explicit mat4x4_t(const quat_t<T>& q) :
+    explicit ZMATH_CONSTEXPR mat4x4_t(const quat_t<T>& q) :
         m11(1 - 2 * (q.y * q.y + q.z * q.z)), m12(2 * (q.x * q.y - q.z * q.w)),     m13(2 * (q.x * q.z + q.y * q.w)),     m14(0),
         m21(2 * (q.x * q.y + q.z * q.w)),     m22(1 - 2 * (q.x * q.x + q.z * q.z)), m23(2 * (q.y * q.z - q.x * q.w)),     m24(0),
         m31(2 * (q.x * q.z - q.y * q.w)),     m32(2 * (q.y * q.z + q.x * q.w)),     m33(1 - 2 * (q.x * q.x + q.y * q.y)), m34(0),
         m41(0),                               m42(0),                               m43(0),                               m44(1) {}
-    mat4x4_t(const quat_t<T>& q, const vec3_t<T>& pos) :
+    ZMATH_CONSTEXPR mat4x4_t(const quat_t<T>& q, const vec3_t<T>& pos) :
         m11(1 - 2 * (q.y * q.y + q.z * q.z)), m12(2 * (q.x * q.y - q.z * q.w)),     m13(2 * (q.x * q.z + q.y * q.w)),     m14(0),
         m21(2 * (q.x * q.y + q.z * q.w)),     m22(1 - 2 * (q.x * q.x + q.z * q.z)), m23(2 * (q.y * q.z - q.x * q.w)),     m24(0),
         m31(2 * (q.x * q.z - q.y * q.w)),     m32(2 * (q.y * q.z + q.x * q.w)),     m33(1 - 2 * (q.x * q.x + q.y * q.y)), m34(0),
         m41(pos.x),                           m42(pos.y),                           m43(pos.z),                           m44(1) {}
-    explicit mat4x4_t(const T* p) :
+    explicit ZMATH_CONSTEXPR mat4x4_t(const T* p) :
         m11(p[0]),  m12(p[1]),  m13(p[2]),  m14(p[3]),
         m21(p[4]),  m22(p[5]),  m23(p[6]),  m24(p[7]),
         m31(p[8]),  m32(p[9]),  m33(p[10]), m34(p[11]),
         m41(p[12]), m42(p[13]), m43(p[14]), m44(p[15]) {}
+    template<class U>
+    explicit ZMATH_CONSTEXPR mat4x4_t(const mat4x4_t<U>& m) :
+        m11(T(m.m11)), m12(T(m.m12)), m13(T(m.m13)), m14(T(m.m14)),
+        m21(T(m.m21)), m22(T(m.m22)), m23(T(m.m23)), m24(T(m.m24)),
+        m31(T(m.m31)), m32(T(m.m32)), m33(T(m.m33)), m34(T(m.m34)),
+        m41(T(m.m41)), m42(T(m.m42)), m43(T(m.m43)), m44(T(m.m44)) {}
 
     // Unary operators
-    mat4x4_t operator - () const {
+    ZMATH_CONSTEXPR mat4x4_t operator - () const {
         return mat4x4_t(-m11, -m12, -m13, -m14,
                         -m21, -m22, -m23, -m24,
                         -m31, -m32, -m33, -m34,
                         -m41, -m42, -m43, -m44);
     }
 
+    // Always returns the computed inverse; a singular matrix asserts and
+    // otherwise gives inf or NaN elements, see try_inverse.
     mat4x4_t operator ! () const {
-        auto c11 =  det3x3(m22, m23, m24, m32, m33, m34, m42, m43, m44);
-        auto c12 = -det3x3(m12, m13, m14, m32, m33, m34, m42, m43, m44);
-        auto c13 =  det3x3(m12, m13, m14, m22, m23, m24, m42, m43, m44);
-        auto c14 = -det3x3(m12, m13, m14, m22, m23, m24, m32, m33, m34);
-        auto det = m11 * c11 + m21 * c12 + m31 * c13 + m41 * c14;
-        assert(fabs(det) > std::numeric_limits<T>::epsilon());
-        return mat4x4_t( c11 / det,                                                  c12 / det,                                                  c13 / det,                                                  c14 / det,
-                        -det3x3(m21, m23, m24, m31, m33, m34, m41, m43, m44) / det,  det3x3(m11, m13, m14, m31, m33, m34, m41, m43, m44) / det, -det3x3(m11, m13, m14, m21, m23, m24, m41, m43, m44) / det,  det3x3(m11, m13, m14, m21, m23, m24, m31, m33, m34) / det,
-                         det3x3(m21, m22, m24, m31, m32, m34, m41, m42, m44) / det, -det3x3(m11, m12, m14, m31, m32, m34, m41, m42, m44) / det,  det3x3(m11, m12, m14, m21, m22, m24, m41, m42, m44) / det, -det3x3(m11, m12, m14, m21, m22, m24, m31, m32, m34) / det,
-                        -det3x3(m21, m22, m23, m31, m32, m33, m41, m42, m43) / det,  det3x3(m11, m12, m13, m31, m32, m33, m41, m42, m43) / det, -det3x3(m11, m12, m13, m21, m22, m23, m41, m42, m43) / det,  det3x3(m11, m12, m13, m21, m22, m23, m31, m32, m33) / det);
+        mat4x4_t tmp;
+        auto det = inverse_det(*this, tmp);
+        assert(det != 0 && std::isfinite(1 / det));
+        (void)det;
+        return tmp;
     }
 
     // Binary operators
-    mat4x4_t operator + (const mat4x4_t& mat) const {
+    ZMATH_CONSTEXPR mat4x4_t operator + (const mat4x4_t& mat) const {
         return mat4x4_t(m11 + mat.m11, m12 + mat.m12, m13 + mat.m13, m14 + mat.m14,
                         m21 + mat.m21, m22 + mat.m22, m23 + mat.m23, m24 + mat.m24,
                         m31 + mat.m31, m32 + mat.m32, m33 + mat.m33, m34 + mat.m34,
                         m41 + mat.m41, m42 + mat.m42, m43 + mat.m43, m44 + mat.m44);
     }
 
-    mat4x4_t operator - (const mat4x4_t& mat) const {
+    ZMATH_CONSTEXPR mat4x4_t operator - (const mat4x4_t& mat) const {
         return mat4x4_t(m11 - mat.m11, m12 - mat.m12, m13 - mat.m13, m14 - mat.m14,
                         m21 - mat.m21, m22 - mat.m22, m23 - mat.m23, m24 - mat.m24,
                         m31 - mat.m31, m32 - mat.m32, m33 - mat.m33, m34 - mat.m34,
@@ -117,14 +120,14 @@ struct mat4x4_t {
         return tmp;
     }
 
-    mat4x4_t operator * (T f) const {
+    ZMATH_CONSTEXPR mat4x4_t operator * (T f) const {
         return mat4x4_t(m11 * f, m12 * f, m13 * f, m14 * f,
                         m21 * f, m22 * f, m23 * f, m24 * f,
                         m31 * f, m32 * f, m33 * f, m34 * f,
                         m41 * f, m42 * f, m43 * f, m44 * f);
     }
 
-    friend mat4x4_t operator * (T f, const mat4x4_t& mat) {
+    friend ZMATH_CONSTEXPR mat4x4_t operator * (T f, const mat4x4_t& mat) {
         return mat4x4_t(mat.m11 * f, mat.m12 * f, mat.m13 * f, mat.m14 * f,
                         mat.m21 * f, mat.m22 * f, mat.m23 * f, mat.m24 * f,
                         mat.m31 * f, mat.m32 * f, mat.m33 * f, mat.m34 * f,
@@ -246,21 +249,23 @@ struct mat4x4_t {
         return vec4_t<T>(m[0][index], m[1][index], m[2][index], m[3][index]);
     }
 
-    T determinant() const {
-        return det4x4(m11, m12, m13, m14,
-                      m21, m22, m23, m24,
-                      m31, m32, m33, m34,
-                      m41, m42, m43, m44);
+    ZMATH_CONSTEXPR T determinant() const {
+        return det2x2(m11, m12, m21, m22) * det2x2(m33, m34, m43, m44)
+             - det2x2(m11, m13, m21, m23) * det2x2(m32, m34, m42, m44)
+             + det2x2(m11, m14, m21, m24) * det2x2(m32, m33, m42, m43)
+             + det2x2(m12, m13, m22, m23) * det2x2(m31, m34, m41, m44)
+             - det2x2(m12, m14, m22, m24) * det2x2(m31, m33, m41, m43)
+             + det2x2(m13, m14, m23, m24) * det2x2(m31, m32, m41, m42);
     }
 
-    static mat4x4_t identity() {
+    static ZMATH_CONSTEXPR mat4x4_t identity() {
         return mat4x4_t(1, 0, 0, 0,
                         0, 1, 0, 0,
                         0, 0, 1, 0,
                         0, 0, 0, 1);
     }
 
-    static mat4x4_t zero() {
+    static ZMATH_CONSTEXPR mat4x4_t zero() {
         return mat4x4_t(0, 0, 0, 0,
                         0, 0, 0, 0,
                         0, 0, 0, 0,
@@ -268,8 +273,8 @@ struct mat4x4_t {
     }
 
     static mat4x4_t rotation(const vec3_t<T>& axis, T angle) {
-        auto ca = cos(angle);
-        auto sa = sin(angle);
+        T sa, ca;
+        sincos(angle, sa, ca);
         auto dir = normalize(axis);
         auto g = 1 - ca;
         return mat4x4_t(dir.x * dir.x * g + ca,         dir.x * dir.y * g - dir.z * sa, dir.x * dir.z * g + dir.y * sa, 0,
@@ -279,12 +284,10 @@ struct mat4x4_t {
     }
 
     static mat4x4_t rotation(T pitch, T yaw, T roll) {
-        auto sx = sin(pitch);
-        auto cx = cos(pitch);
-        auto sy = sin(yaw);
-        auto cy = cos(yaw);
-        auto sz = sin(roll);
-        auto cz = cos(roll);
+        T sx, cx, sy, cy, sz, cz;
+        sincos(pitch, sx, cx);
+        sincos(yaw, sy, cy);
+        sincos(roll, sz, cz);
         auto c1 = cy * -sz;
         auto c2 = sy *  sz;
         return mat4x4_t( cy * cz, (c1 * cx) + (sy * sx), (c1 * -sx) + (sy * cx), 0,
@@ -294,8 +297,8 @@ struct mat4x4_t {
     }
 
     static mat4x4_t rotationX(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
         return mat4x4_t(1,  0,        0,        0,
                         0,  cosAngle, sinAngle, 0,
                         0, -sinAngle, cosAngle, 0,
@@ -303,8 +306,8 @@ struct mat4x4_t {
     }
 
     static mat4x4_t rotationY(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
         return mat4x4_t(cosAngle, 0, -sinAngle, 0,
                         0,        1,  0,        0,
                         sinAngle, 0,  cosAngle, 0,
@@ -312,43 +315,43 @@ struct mat4x4_t {
     }
 
     static mat4x4_t rotationZ(T angle) {
-        auto cosAngle = cos(angle);
-        auto sinAngle = sin(angle);
+        T sinAngle, cosAngle;
+        sincos(angle, sinAngle, cosAngle);
         return mat4x4_t( cosAngle, sinAngle, 0, 0,
                         -sinAngle, cosAngle, 0, 0,
                          0,        0,        1, 0,
                          0,        0,        0, 1);
     }
 
-    static mat4x4_t translation(T dx, T dy, T dz) {
+    static ZMATH_CONSTEXPR mat4x4_t translation(T dx, T dy, T dz) {
         return mat4x4_t(1,  0,  0,  0,
                         0,  1,  0,  0,
                         0,  0,  1,  0,
                         dx, dy, dz, 1);
     }
 
-    static mat4x4_t translation(const vec3_t<T>& t) {
+    static ZMATH_CONSTEXPR mat4x4_t translation(const vec3_t<T>& t) {
         return mat4x4_t(1,   0,   0,  0,
                         0,   1,   0,  0,
                         0,   0,   1,  0,
                         t.x, t.y, t.z, 1);
     }
 
-    static mat4x4_t scale(T s) {
+    static ZMATH_CONSTEXPR mat4x4_t scale(T s) {
         return mat4x4_t(s,  0, 0, 0,
                         0,  s, 0, 0,
                         0,  0, s, 0,
                         0,  0, 0, 1);
     }
 
-    static mat4x4_t scale(T sx, T sy, T sz) {
+    static ZMATH_CONSTEXPR mat4x4_t scale(T sx, T sy, T sz) {
         return mat4x4_t(sx,  0,  0, 0,
                         0,  sy,  0, 0,
                         0,   0, sz, 0,
                         0,   0,  0, 1);
     }
 
-    static mat4x4_t scale(const vec3_t<T>& s) {
+    static ZMATH_CONSTEXPR mat4x4_t scale(const vec3_t<T>& s) {
         return mat4x4_t(s.x, 0,   0,   0,
                         0,   s.y, 0,   0,
                         0,   0,   s.z, 0,
@@ -369,9 +372,11 @@ struct mat4x4_t {
 
     static mat4x4_t perspectiveLH(T fov, T aspect, T minZ, T maxZ) {
         assert(fabs(maxZ - minZ) > std::numeric_limits<T>::epsilon());
-        assert(fabs(sin(fov / 2)) > std::numeric_limits<T>::epsilon());
 
-        auto ctg = cos(fov / 2) / sin(fov / 2);
+        T s, c;
+        sincos(fov / 2, s, c);
+        assert(fabs(s) > std::numeric_limits<T>::epsilon());
+        auto ctg = c / s;
         auto q = maxZ / (maxZ - minZ);
         return mat4x4_t<T>(ctg/aspect, 0,    0,        0,
                            0,          ctg,  0,        0,
@@ -381,9 +386,11 @@ struct mat4x4_t {
 
     static mat4x4_t perspectiveRH(T fov, T aspect, T minZ, T maxZ) {
         assert(fabs(minZ - maxZ) > std::numeric_limits<T>::epsilon());
-        assert(fabs(sin(fov / 2)) > std::numeric_limits<T>::epsilon());
 
-        auto ctg = cos(fov / 2) / sin(fov / 2);
+        T s, c;
+        sincos(fov / 2, s, c);
+        assert(fabs(s) > std::numeric_limits<T>::epsilon());
+        auto ctg = c / s;
         auto q = maxZ / (minZ - maxZ);
         return mat4x4_t(ctg/aspect, 0,   0,         0,
                         0,          ctg, 0,         0,
@@ -435,7 +442,7 @@ struct mat4x4_t {
                         0,       0,        range*minZ, 1);
     }
 
-    static mat4x4_t viewport(int width, int height, int x, int y, T minZ, T maxZ) {
+    static ZMATH_CONSTEXPR mat4x4_t viewport(int width, int height, int x, int y, T minZ, T maxZ) {
         return mat4x4_t(width/(T)2,      0,               0,           0,
                         0,              -height/(T)2,     0,           0,
                         0,               0,               maxZ - minZ, 0,
@@ -444,9 +451,184 @@ struct mat4x4_t {
 };
 
 template<class T>
-mat4x4_t<T> transpose(const mat4x4_t<T>& mat) {
+ZMATH_CONSTEXPR mat4x4_t<T> transpose(const mat4x4_t<T>& mat) {
     return mat4x4_t<T>(mat.m11, mat.m21, mat.m31, mat.m41,
                        mat.m12, mat.m22, mat.m32, mat.m42,
                        mat.m13, mat.m23, mat.m33, mat.m43,
                        mat.m14, mat.m24, mat.m34, mat.m44);
 }
+
+// Writes the inverse to result and returns the determinant, without checking
+// it. The cofactors share the twelve 2x2 minors of the upper and lower row
+// pairs (Laplace expansion).
+template<class T>
+T inverse_det(const mat4x4_t<T>& mat, mat4x4_t<T>& result) {
+    auto s0 = det2x2(mat.m11, mat.m12, mat.m21, mat.m22);
+    auto s1 = det2x2(mat.m11, mat.m13, mat.m21, mat.m23);
+    auto s2 = det2x2(mat.m11, mat.m14, mat.m21, mat.m24);
+    auto s3 = det2x2(mat.m12, mat.m13, mat.m22, mat.m23);
+    auto s4 = det2x2(mat.m12, mat.m14, mat.m22, mat.m24);
+    auto s5 = det2x2(mat.m13, mat.m14, mat.m23, mat.m24);
+
+    auto c0 = det2x2(mat.m31, mat.m32, mat.m41, mat.m42);
+    auto c1 = det2x2(mat.m31, mat.m33, mat.m41, mat.m43);
+    auto c2 = det2x2(mat.m31, mat.m34, mat.m41, mat.m44);
+    auto c3 = det2x2(mat.m32, mat.m33, mat.m42, mat.m43);
+    auto c4 = det2x2(mat.m32, mat.m34, mat.m42, mat.m44);
+    auto c5 = det2x2(mat.m33, mat.m34, mat.m43, mat.m44);
+
+    auto det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    auto invDet = 1 / det;
+    result = mat4x4_t<T>(( mat.m22 * c5 - mat.m23 * c4 + mat.m24 * c3) * invDet,
+                         (-mat.m12 * c5 + mat.m13 * c4 - mat.m14 * c3) * invDet,
+                         ( mat.m42 * s5 - mat.m43 * s4 + mat.m44 * s3) * invDet,
+                         (-mat.m32 * s5 + mat.m33 * s4 - mat.m34 * s3) * invDet,
+
+                         (-mat.m21 * c5 + mat.m23 * c2 - mat.m24 * c1) * invDet,
+                         ( mat.m11 * c5 - mat.m13 * c2 + mat.m14 * c1) * invDet,
+                         (-mat.m41 * s5 + mat.m43 * s2 - mat.m44 * s1) * invDet,
+                         ( mat.m31 * s5 - mat.m33 * s2 + mat.m34 * s1) * invDet,
+
+                         ( mat.m21 * c4 - mat.m22 * c2 + mat.m24 * c0) * invDet,
+                         (-mat.m11 * c4 + mat.m12 * c2 - mat.m14 * c0) * invDet,
+                         ( mat.m41 * s4 - mat.m42 * s2 + mat.m44 * s0) * invDet,
+                         (-mat.m31 * s4 + mat.m32 * s2 - mat.m34 * s0) * invDet,
+
+                         (-mat.m21 * c3 + mat.m22 * c1 - mat.m23 * c0) * invDet,
+                         ( mat.m11 * c3 - mat.m12 * c1 + mat.m13 * c0) * invDet,
+                         (-mat.m41 * s3 + mat.m42 * s1 - mat.m43 * s0) * invDet,
+                         ( mat.m31 * s3 - mat.m32 * s1 + mat.m33 * s0) * invDet);
+    return det;
+}
+
+// Inverts the matrix unless it is singular, i.e. the determinant is zero or so
+// small that 1 / det overflows. There is no epsilon test, so uniformly scaled
+// matrices invert at any scale. On failure false is returned and result is
+// left untouched.
+template<class T>
+bool try_inverse(const mat4x4_t<T>& mat, mat4x4_t<T>& result) {
+    mat4x4_t<T> tmp;
+    auto det = inverse_det(mat, tmp);
+    if (det == 0 || !std::isfinite(1 / det)) {
+        return false;
+    }
+
+    result = tmp;
+    return true;
+}
+
+// Inverse of a matrix whose last column is (0, 0, 0, 1): only the 3x3 part is
+// inverted and the translation is carried through it.
+template<class T>
+mat4x4_t<T> inverse_affine(const mat4x4_t<T>& mat) {
+    auto r = !mat3x3_t<T>(mat);
+    auto t = -(vec3_t<T>(mat.m41, mat.m42, mat.m43) * r);
+    return mat4x4_t<T>(r.m11, r.m12, r.m13, 0,
+                       r.m21, r.m22, r.m23, 0,
+                       r.m31, r.m32, r.m33, 0,
+                       t.x,   t.y,   t.z,   1);
+}
+
+// Inverse of a rotation + translation matrix, where the 3x3 part is orthonormal
+// and its inverse is the transpose.
+template<class T>
+ZMATH_CONSTEXPR14 mat4x4_t<T> inverse_rigid(const mat4x4_t<T>& mat) {
+    auto r = transpose(mat3x3_t<T>(mat));
+    auto t = -(vec3_t<T>(mat.m41, mat.m42, mat.m43) * r);
+    return mat4x4_t<T>(r.m11, r.m12, r.m13, 0,
+                       r.m21, r.m22, r.m23, 0,
+                       r.m31, r.m32, r.m33, 0,
+                       t.x,   t.y,   t.z,   1);
+}
+
+#if defined(ZMATH_SIMD)
+// Each row of the product is a linear combination of the rows of the right-hand
+// matrix, weighted by the matching row of the left-hand one.
+template<>
+inline mat4x4_t<float> mat4x4_t<float>::operator * (const mat4x4_t<float>& mat) const {
+    auto r1 = simd_load(mat.m[0]);
+    auto r2 = simd_load(mat.m[1]);
+    auto r3 = simd_load(mat.m[2]);
+    auto r4 = simd_load(mat.m[3]);
+    mat4x4_t<float> tmp;
+
+    for (int i = 0; i < 4; ++i) {
+        auto row = simd_mul(simd_splat(m[i][0]), r1);
+        row = simd_madd(simd_splat(m[i][1]), r2, row);
+        row = simd_madd(simd_splat(m[i][2]), r3, row);
+        row = simd_madd(simd_splat(m[i][3]), r4, row);
+        simd_store(tmp.m[i], row);
+    }
+
+    return tmp;
+}
+
+template<>
+inline mat4x4_t<float>& mat4x4_t<float>::operator *= (const mat4x4_t<float>& mat) {
+    *this = *this * mat;
+    return *this;
+}
+
+// 2x2 blocks are kept row-major in one register each: (m11, m12, m21, m22)
+inline simd4f simd_mat2_mul(simd4f a, simd4f b) {
+    return simd_add(simd_mul(a, simd_shuffle<0, 3, 0, 3>(b, b)),
+                    simd_mul(simd_shuffle<1, 0, 3, 2>(a, a), simd_shuffle<2, 1, 2, 1>(b, b)));
+}
+
+// adj(a) * b
+inline simd4f simd_mat2_adj_mul(simd4f a, simd4f b) {
+    return simd_sub(simd_mul(simd_shuffle<3, 3, 0, 0>(a, a), b),
+                    simd_mul(simd_shuffle<1, 1, 2, 2>(a, a), simd_shuffle<2, 3, 0, 1>(b, b)));
+}
+
+// a * adj(b)
+inline simd4f simd_mat2_mul_adj(simd4f a, simd4f b) {
+    return simd_sub(simd_mul(a, simd_shuffle<3, 0, 3, 0>(b, b)),
+                    simd_mul(simd_shuffle<1, 0, 3, 2>(a, a), simd_shuffle<2, 1, 2, 1>(b, b)));
+}
+
+// Blockwise inverse of [A B; C D] built from the adjugates of the 2x2 blocks.
+template<>
+inline float inverse_det(const mat4x4_t<float>& mat, mat4x4_t<float>& result) {
+    auto r1 = simd_load(mat.m[0]);
+    auto r2 = simd_load(mat.m[1]);
+    auto r3 = simd_load(mat.m[2]);
+    auto r4 = simd_load(mat.m[3]);
+
+    auto a = simd_shuffle<0, 1, 0, 1>(r1, r2);
+    auto b = simd_shuffle<2, 3, 2, 3>(r1, r2);
+    auto c = simd_shuffle<0, 1, 0, 1>(r3, r4);
+    auto d = simd_shuffle<2, 3, 2, 3>(r3, r4);
+
+    // (|A|, |B|, |C|, |D|)
+    auto dets = simd_sub(simd_mul(simd_shuffle<0, 2, 0, 2>(r1, r3), simd_shuffle<1, 3, 1, 3>(r2, r4)),
+                         simd_mul(simd_shuffle<1, 3, 1, 3>(r1, r3), simd_shuffle<0, 2, 0, 2>(r2, r4)));
+    auto detA = simd_shuffle<0, 0, 0, 0>(dets, dets);
+    auto detB = simd_shuffle<1, 1, 1, 1>(dets, dets);
+    auto detC = simd_shuffle<2, 2, 2, 2>(dets, dets);
+    auto detD = simd_shuffle<3, 3, 3, 3>(dets, dets);
+
+    auto dc = simd_mat2_adj_mul(d, c);
+    auto ab = simd_mat2_adj_mul(a, b);
+    auto x = simd_sub(simd_mul(detD, a), simd_mat2_mul(b, dc));
+    auto w = simd_sub(simd_mul(detA, d), simd_mat2_mul(c, ab));
+    auto y = simd_sub(simd_mul(detB, c), simd_mat2_mul_adj(d, ab));
+    auto z = simd_sub(simd_mul(detC, b), simd_mat2_mul_adj(a, dc));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+    auto det = simd_get_x(detA) * simd_get_x(detD) + simd_get_x(detB) * simd_get_x(detC)
+             - simd_hadd(simd_mul(ab, simd_shuffle<0, 2, 1, 3>(dc, dc)));
+
+    auto invDet = simd_mul(simd_splat(1 / det), simd_set(1, -1, -1, 1));
+    x = simd_mul(x, invDet);
+    y = simd_mul(y, invDet);
+    z = simd_mul(z, invDet);
+    w = simd_mul(w, invDet);
+
+    simd_store(result.m[0], simd_shuffle<3, 1, 3, 1>(x, y));
+    simd_store(result.m[1], simd_shuffle<2, 0, 2, 0>(x, y));
+    simd_store(result.m[2], simd_shuffle<3, 1, 3, 1>(z, w));
+    simd_store(result.m[3], simd_shuffle<2, 0, 2, 0>(z, w));
+    return det;
+}
+#endif
@@ -30,6 +30,8 @@ struct plane_t {
     plane_t(T a, T b, T c, T d) : normal(a, b, c), dist(d) {}
     plane_t(const vec3_t<T>& normal, T dist) : normal(normal), dist(dist) {}
     plane_t(const vec3_t<T>& normal, const vec3_t<T>& p) : normal(normal), dist(-dot(normal, p)) {}
+    template<class U>
+    explicit plane_t(const plane_t<U>& p) : normal(p.normal), dist(T(p.dist)) {}
 
     plane_t(const vec3_t<T>& p1, const vec3_t<T>& p2, const vec3_t<T>& p3) {
         normal = normalize(cross(p3 - p2, p1 - p2));
@@ -82,7 +84,47 @@ plane_t<T> normalize(const plane_t<T>& p) {
     return plane_t<T>(p.normal * m, p.dist * m);
 }
 
+// normalize with the estimate of rsqrt_fast
+template<class T>
+plane_t<T> normalize_fast(const plane_t<T>& p) {
+    auto d = dot(p.normal, p.normal);
+    auto m = (d > sqr(std::numeric_limits<T>::epsilon())) ? rsqrt_fast(d) : T(0);
+    return plane_t<T>(p.normal * m, p.dist * m);
+}
+
+template<class T>
+void normalize_fast(plane_t<T>* out, const plane_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = normalize_fast(in[i]);
+    }
+}
+
 template<class T>
 T dot(const plane_t<T>& p, const vec3_t<T>& v) {
     return dot(p.normal, v) + p.dist;
 }
+
+#if defined(ZMATH_SIMD)
+// The distance is scaled along with the normal
+template<>
+inline void normalize_fast(plane_t<float>* out, const plane_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f v[4], c[4];
+        for (int j = 0; j < 4; ++j) {
+            v[j] = c[j] = simd_load(&in[i * 4 + j].normal.x);
+        }
+        simd_transpose(c[0], c[1], c[2], c[3]);
+        auto m = simd_normalize_scale(simd_madd(c[0], c[0], simd_madd(c[1], c[1], simd_mul(c[2], c[2]))));
+        simd_store(&out[i * 4].normal.x,     simd_mul(v[0], simd_shuffle<0, 0, 0, 0>(m, m)));
+        simd_store(&out[i * 4 + 1].normal.x, simd_mul(v[1], simd_shuffle<1, 1, 1, 1>(m, m)));
+        simd_store(&out[i * 4 + 2].normal.x, simd_mul(v[2], simd_shuffle<2, 2, 2, 2>(m, m)));
+        simd_store(&out[i * 4 + 3].normal.x, simd_mul(v[3], simd_shuffle<3, 3, 3, 3>(m, m)));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = normalize_fast(in[i]);
+    }
+}
+#endif
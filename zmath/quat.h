@@ -21,29 +21,69 @@
 //
 #pragma once
 
+// Coefficients of sin(t*phi) / sin(phi) expanded in powers of cos(phi) - 1,
+// after Eberly, "A Fast and Accurate Algorithm for Computing SLERP". The last
+// term is scaled to absorb the truncation error.
+template<class T>
+struct quat_slerp_coeffs {
+    enum { COUNT = 8 };
+    static const T u[COUNT];
+    static const T v[COUNT];
+};
+
+template<class T>
+const T quat_slerp_coeffs<T>::u[] = {
+    T(1.0 / 3),  T(1.0 / 10), T(1.0 / 21),  T(1.0 / 36),
+    T(1.0 / 55), T(1.0 / 78), T(1.0 / 105), T(1.855 / 136)
+};
+
+template<class T>
+const T quat_slerp_coeffs<T>::v[] = {
+    T(1.0 / 3),  T(2.0 / 5),  T(3.0 / 7),   T(4.0 / 9),
+    T(5.0 / 11), T(6.0 / 13), T(7.0 / 15),  T(1.855 * 8 / 17)
+};
+
+// Approximates sin(t*phi) / sin(phi) for cos(phi) = c in [0, 1], t in [0, 1].
+// The absolute error is below 2e-5.
+template<class T>
+T quat_slerp_weight(T t, T c) {
+    typedef quat_slerp_coeffs<T> coeffs;
+    auto t2 = t * t;
+    auto cm1 = c - 1;
+    T b = 1;
+
+    for (int i = coeffs::COUNT - 1; i >= 0; --i) {
+        b = 1 + (coeffs::u[i] * t2 - coeffs::v[i]) * cm1 * b;
+    }
+
+    return t * b;
+}
+
 template<class T>
 struct quat_t {
     T x, y, z, w;
 
-    quat_t() : x(0), y(0), z(0), w(1) {}
-    quat_t(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}
-    explicit quat_t(const T* p) : x(p[0]), y(p[1]), z(p[2]), w(p[3]) {}
+    ZMATH_CONSTEXPR quat_t() : x(0), y(0), z(0), w(1) {}
+    ZMATH_CONSTEXPR quat_t(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}
+    explicit ZMATH_CONSTEXPR quat_t(const T* p) : x(p[0]), y(p[1]), z(p[2]), w(p[3]) {}
+    template<class U>
+    explicit ZMATH_CONSTEXPR quat_t(const quat_t<U>& q) : x(T(q.x)), y(T(q.y)), z(T(q.z)), w(T(q.w)) {}
 
     // Unary operators
-    quat_t operator - () const {
+    ZMATH_CONSTEXPR quat_t operator - () const {
         return quat_t(-x, -y, -z, -w);
     }
 
-    quat_t operator ! () const {
+    ZMATH_CONSTEXPR quat_t operator ! () const {
         return quat_t(-x, -y, -z, w);
     }
 
     // Binary operators
-    quat_t operator * (T f) const {
+    ZMATH_CONSTEXPR quat_t operator * (T f) const {
         return quat_t(x * f, y * f, z * f, w * f);
     }
 
-    friend quat_t operator * (T f, const quat_t& q) {
+    friend ZMATH_CONSTEXPR quat_t operator * (T f, const quat_t& q) {
         return quat_t(q.x * f, q.y * f, q.z * f, q.w * f);
     }
 
@@ -52,7 +92,7 @@ struct quat_t {
         return quat_t(x / f, y / f, z / f, w / f);
     }
 
-    quat_t& operator *= (T f) {
+    ZMATH_CONSTEXPR14 quat_t& operator *= (T f) {
         x *= f;
         y *= f;
         z *= f;
@@ -69,11 +109,11 @@ struct quat_t {
         return *this;
     }
 
-    quat_t operator + (const quat_t& q) const {
+    ZMATH_CONSTEXPR quat_t operator + (const quat_t& q) const {
         return quat_t(x + q.x, y + q.y, z + q.z, w + q.w);
     }
 
-    quat_t operator - (const quat_t& q) const {
+    ZMATH_CONSTEXPR quat_t operator - (const quat_t& q) const {
         return quat_t(x - q.x, y - q.y, z - q.z, w - q.w);
     }
 
@@ -93,7 +133,7 @@ struct quat_t {
                       ( w * q.w + x * q.x + y * q.y + z * q.z) / m);
     }
 
-    quat_t& operator += (const quat_t& q) {
+    ZMATH_CONSTEXPR14 quat_t& operator += (const quat_t& q) {
         x += q.x;
         y += q.y;
         z += q.z;
@@ -101,7 +141,7 @@ struct quat_t {
         return *this;
     }
 
-    quat_t& operator -= (const quat_t& q) {
+    ZMATH_CONSTEXPR14 quat_t& operator -= (const quat_t& q) {
         x -= q.x;
         y -= q.y;
         z -= q.z;
@@ -119,11 +159,11 @@ struct quat_t {
     }
 
     // Comparison operators
-    bool operator == (const quat_t& q) const {
+    ZMATH_CONSTEXPR bool operator == (const quat_t& q) const {
         return x == q.x && y == q.y && z == q.z && w == q.w;
     }
 
-    bool operator != (const quat_t& q) const {
+    ZMATH_CONSTEXPR bool operator != (const quat_t& q) const {
         return x != q.x || y != q.y || z != q.z || w != q.w;
     }
 
@@ -136,20 +176,27 @@ struct quat_t {
     }
 
     static quat_t rotation_axis(const vec3_t<T>& v, T angle) {
-        auto sine = sin(angle / 2);
-        return quat_t(sine * v.x, sine * v.y, sine * v.z, cos(angle / 2));
+        T s, c;
+        sincos(T(angle / 2), s, c);
+        return quat_t(s * v.x, s * v.y, s * v.z, c);
     }
 
     static quat_t rotation_x(T angle) {
-        return quat_t(sin(angle / 2), 0, 0, cos(angle / 2));
+        T s, c;
+        sincos(T(angle / 2), s, c);
+        return quat_t(s, 0, 0, c);
     }
 
     static quat_t rotation_y(T angle) {
-        return quat_t(0, sin(angle / 2), 0, cos(angle / 2));
+        T s, c;
+        sincos(T(angle / 2), s, c);
+        return quat_t(0, s, 0, c);
     }
 
     static quat_t rotation_z(T angle) {
-        return quat_t(0, 0, sin(angle / 2), cos(angle / 2));
+        T s, c;
+        sincos(T(angle / 2), s, c);
+        return quat_t(0, 0, s, c);
     }
 
     static quat_t shortest_arc(const vec3_t<T>& from, const vec3_t<T>& to) {
@@ -299,10 +346,32 @@ struct quat_t {
 
         return scale0 * from + scale1 * temp;
     }
+
+    // Normalized linear interpolation along the shorter arc. Constant
+    // velocity is not preserved, the result is exact at 0, 0.5 and 1.
+    static quat_t nlerp(const quat_t& from, const quat_t& to, T scale) {
+        auto s = (dot(from, to) < 0) ? T(-scale) : scale;
+        return normalize(from * (1 - scale) + to * s);
+    }
+
+    // Polynomial slerp without trigonometric calls or branches on the angle.
+    // Expects unit quaternions and scale in [0, 1]; the result deviates from
+    // slerp by less than 2e-5 radians and from unit length by less than 3e-5.
+    static quat_t slerp_fast(const quat_t& from, const quat_t& to, T scale) {
+        auto c = dot(from, to);
+        T s = 1;
+
+        if (c < 0) {
+            c = -c;
+            s = -1;
+        }
+
+        return from * quat_slerp_weight(T(1 - scale), c) + to * (s * quat_slerp_weight(scale, c));
+    }
 };
 
 template<class T>
-T dot(const quat_t<T>& q1, const quat_t<T>& q2) {
+ZMATH_CONSTEXPR T dot(const quat_t<T>& q1, const quat_t<T>& q2) {
     return q1.x*q2.x + q1.y*q2.y + q1.z*q2.z + q1.w*q2.w;
 }
 
@@ -323,3 +392,205 @@ quat_t<T> normalize(const quat_t<T>& q) {
 
     return quat_t<T>(q.x * m, q.y * m, q.z * m, q.w * m);
 }
+
+// normalize with the estimate of rsqrt_fast
+template<class T>
+quat_t<T> normalize_fast(const quat_t<T>& q) {
+    auto d = dot(q, q);
+    auto m = (d > sqr(std::numeric_limits<T>::epsilon())) ? rsqrt_fast(d) : T(0);
+    return quat_t<T>(q.x * m, q.y * m, q.z * m, q.w * m);
+}
+
+template<class T>
+void normalize_fast(quat_t<T>* out, const quat_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = normalize_fast(in[i]);
+    }
+}
+
+// Interpolate count pairs of quaternions by per-pair factors.
+template<class T>
+void nlerp(quat_t<T>* out, const quat_t<T>* from, const quat_t<T>* to, const T* scales, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = quat_t<T>::nlerp(from[i], to[i], scales[i]);
+    }
+}
+
+template<class T>
+void slerp_fast(quat_t<T>* out, const quat_t<T>* from, const quat_t<T>* to, const T* scales, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = quat_t<T>::slerp_fast(from[i], to[i], scales[i]);
+    }
+}
+
+#if defined(ZMATH_SIMD)
+template<>
+inline quat_t<float> quat_t<float>::operator * (const quat_t<float>& q) const {
+    auto v = simd_load(&q.x);
+    auto r = simd_mul(simd_splat(w), v);
+    r = simd_madd(simd_splat(x), simd_mul(simd_wzyx(v), simd_set( 1, -1,  1, -1)), r);
+    r = simd_madd(simd_splat(y), simd_mul(simd_zwxy(v), simd_set( 1,  1, -1, -1)), r);
+    r = simd_madd(simd_splat(z), simd_mul(simd_yxwz(v), simd_set(-1,  1,  1, -1)), r);
+    quat_t<float> tmp;
+    simd_store(&tmp.x, r);
+    return tmp;
+}
+
+template<>
+inline quat_t<float>& quat_t<float>::operator *= (const quat_t<float>& q) {
+    *this = *this * q;
+    return *this;
+}
+
+template<>
+inline quat_t<float> normalize(const quat_t<float>& q) {
+    auto v = simd_load(&q.x);
+    auto m = sqrt(simd_hadd(simd_mul(v, v)));
+
+    if (m > std::numeric_limits<float>::epsilon()) {
+        m = 1 / m;
+    } else {
+        m = 0;
+    }
+
+    quat_t<float> tmp;
+    simd_store(&tmp.x, simd_mul(v, simd_splat(m)));
+    return tmp;
+}
+
+// The array versions transpose four quaternions at a time and evaluate each
+// lane independently.
+inline void quat_lerp_prepare(const quat_t<float>* from, const quat_t<float>* to,
+                              simd4f (&a)[4], simd4f (&b)[4], simd4f& c) {
+    a[0] = simd_load(&from[0].x);
+    a[1] = simd_load(&from[1].x);
+    a[2] = simd_load(&from[2].x);
+    a[3] = simd_load(&from[3].x);
+    simd_transpose(a[0], a[1], a[2], a[3]);
+
+    b[0] = simd_load(&to[0].x);
+    b[1] = simd_load(&to[1].x);
+    b[2] = simd_load(&to[2].x);
+    b[3] = simd_load(&to[3].x);
+    simd_transpose(b[0], b[1], b[2], b[3]);
+
+    c = simd_mul(a[0], b[0]);
+    c = simd_madd(a[1], b[1], c);
+    c = simd_madd(a[2], b[2], c);
+    c = simd_madd(a[3], b[3], c);
+
+    // Flip the target onto the same hemisphere
+    auto neg = simd_cmplt(c, simd_zero());
+    c = simd_abs(c);
+    for (int j = 0; j < 4; ++j) {
+        b[j] = simd_select(neg, simd_sub(simd_zero(), b[j]), b[j]);
+    }
+}
+
+inline void quat_lerp_store(quat_t<float>* out, simd4f (&r)[4]) {
+    simd_transpose(r[0], r[1], r[2], r[3]);
+    simd_store(&out[0].x, r[0]);
+    simd_store(&out[1].x, r[1]);
+    simd_store(&out[2].x, r[2]);
+    simd_store(&out[3].x, r[3]);
+}
+
+inline simd4f quat_slerp_weight(simd4f t, simd4f c) {
+    typedef quat_slerp_coeffs<float> coeffs;
+    auto one = simd_splat(1.0f);
+    auto t2 = simd_mul(t, t);
+    auto cm1 = simd_sub(c, one);
+    auto b = one;
+
+    for (int i = coeffs::COUNT - 1; i >= 0; --i) {
+        auto k = simd_mul(simd_sub(simd_mul(simd_splat(coeffs::u[i]), t2), simd_splat(coeffs::v[i])), cm1);
+        b = simd_madd(k, b, one);
+    }
+
+    return simd_mul(t, b);
+}
+
+template<>
+inline void nlerp(quat_t<float>* out, const quat_t<float>* from, const quat_t<float>* to, const float* scales, size_t count) {
+    auto blocks = count / 4;
+    auto one = simd_splat(1.0f);
+    auto eps = simd_splat(std::numeric_limits<float>::epsilon());
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f a[4], b[4], c;
+        quat_lerp_prepare(from + i * 4, to + i * 4, a, b, c);
+
+        auto t = simd_load(scales + i * 4);
+        auto s = simd_sub(one, t);
+        simd4f r[4];
+        for (int j = 0; j < 4; ++j) {
+            r[j] = simd_madd(a[j], s, simd_mul(b[j], t));
+        }
+
+        auto m = simd_mul(r[0], r[0]);
+        m = simd_madd(r[1], r[1], m);
+        m = simd_madd(r[2], r[2], m);
+        m = simd_madd(r[3], r[3], m);
+
+        // Lengths at or below epsilon give zero, as in normalize
+        auto len = simd_sqrt(m);
+        m = simd_select(simd_cmpgt(len, eps), simd_div(one, len), simd_zero());
+        for (int j = 0; j < 4; ++j) {
+            r[j] = simd_mul(r[j], m);
+        }
+
+        quat_lerp_store(out + i * 4, r);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = quat_t<float>::nlerp(from[i], to[i], scales[i]);
+    }
+}
+
+template<>
+inline void slerp_fast(quat_t<float>* out, const quat_t<float>* from, const quat_t<float>* to, const float* scales, size_t count) {
+    auto blocks = count / 4;
+    auto one = simd_splat(1.0f);
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f a[4], b[4], c;
+        quat_lerp_prepare(from + i * 4, to + i * 4, a, b, c);
+
+        auto t = simd_load(scales + i * 4);
+        auto s0 = quat_slerp_weight(simd_sub(one, t), c);
+        auto s1 = quat_slerp_weight(t, c);
+        simd4f r[4];
+        for (int j = 0; j < 4; ++j) {
+            r[j] = simd_madd(a[j], s0, simd_mul(b[j], s1));
+        }
+
+        quat_lerp_store(out + i * 4, r);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = quat_t<float>::slerp_fast(from[i], to[i], scales[i]);
+    }
+}
+
+template<>
+inline void normalize_fast(quat_t<float>* out, const quat_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f v[4], c[4];
+        for (int j = 0; j < 4; ++j) {
+            v[j] = c[j] = simd_load(&in[i * 4 + j].x);
+        }
+        simd_transpose(c[0], c[1], c[2], c[3]);
+        auto m = simd_normalize_scale(simd_madd(c[0], c[0], simd_madd(c[1], c[1], simd_madd(c[2], c[2], simd_mul(c[3], c[3])))));
+        simd_store(&out[i * 4].x,     simd_mul(v[0], simd_shuffle<0, 0, 0, 0>(m, m)));
+        simd_store(&out[i * 4 + 1].x, simd_mul(v[1], simd_shuffle<1, 1, 1, 1>(m, m)));
+        simd_store(&out[i * 4 + 2].x, simd_mul(v[2], simd_shuffle<2, 2, 2, 2>(m, m)));
+        simd_store(&out[i * 4 + 3].x, simd_mul(v[3], simd_shuffle<3, 3, 3, 3>(m, m)));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = normalize_fast(in[i]);
+    }
+}
+#endif
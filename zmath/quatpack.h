@@ -0,0 +1,378 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// Smallest-three compression of unit quaternions. The largest component (by
+// magnitude) is dropped and rebuilt from the other three; the quaternion is
+// negated first if needed so the dropped component is positive, which is the
+// same rotation. The remaining components lie in [-1/sqrt(2), 1/sqrt(2)] and
+// are quantized to B bits each. An odd number of levels (code 2^B - 1 is
+// unused) keeps zero exact, so the identity survives a round trip. Every
+// stored component is off by at most 0.71 / (2^B - 2), the rebuilt one by
+// about three times that:
+//
+//   format  layout        max component error
+//   32 bit  2 + 3 x 10    2.1e-3
+//   48 bit  2 + 3 x 15    6.5e-5
+//   64 bit  2 + 3 x 20    2.0e-6
+//
+// The inputs must be normalized. Unpacking yields the canonical sign, i.e. q
+// or -q.
+
+template<int B, class T>
+unsigned long long quat_encode_smallest3(const quat_t<T>& q) {
+    const T c[4] = { q.x, q.y, q.z, q.w };
+    const auto zeroCode = T((1u << B) / 2 - 1);
+    auto largest = 0;
+
+    for (int i = 1; i < 4; ++i) {
+        if (fabs(c[i]) > fabs(c[largest])) {
+            largest = i;
+        }
+    }
+
+    auto sign = (c[largest] < 0) ? T(-1) : T(1);
+    auto bits = (unsigned long long)largest;
+    auto shift = 2;
+
+    for (int i = 0; i < 4; ++i) {
+        if (i != largest) {
+            auto u = clamp(c[i] * sign * (T(1.4142135623730951) * zeroCode) + (zeroCode + T(0.5)), T(0), zeroCode * 2);
+            bits |= (unsigned long long)u << shift;
+            shift += B;
+        }
+    }
+
+    return bits;
+}
+
+template<int B, class T>
+quat_t<T> quat_decode_smallest3(unsigned long long bits) {
+    const auto mask = (1ull << B) - 1;
+    const auto zeroCode = T((1u << B) / 2 - 1);
+    const auto scale = T(0.7071067811865476) / zeroCode;
+    auto largest = int(bits & 3);
+    auto shift = 2;
+    T c[4];
+    T sum = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        if (i != largest) {
+            c[i] = (T((bits >> shift) & mask) - zeroCode) * scale;
+            sum += c[i] * c[i];
+            shift += B;
+        }
+    }
+
+    c[largest] = (sum < 1) ? sqrt(1 - sum) : 0;
+    return quat_t<T>(c[0], c[1], c[2], c[3]);
+}
+
+struct quat48_t {
+    unsigned short bits[3];
+};
+
+template<class T>
+unsigned int pack_quat32(const quat_t<T>& q) {
+    return (unsigned int)quat_encode_smallest3<10>(q);
+}
+
+template<class T>
+quat_t<T> unpack_quat32(unsigned int bits) {
+    return quat_decode_smallest3<10, T>(bits);
+}
+
+template<class T>
+quat48_t pack_quat48(const quat_t<T>& q) {
+    auto bits = quat_encode_smallest3<15>(q);
+    quat48_t r = { { (unsigned short)bits, (unsigned short)(bits >> 16), (unsigned short)(bits >> 32) } };
+    return r;
+}
+
+template<class T>
+quat_t<T> unpack_quat48(const quat48_t& q) {
+    return quat_decode_smallest3<15, T>(q.bits[0] | (unsigned long long)q.bits[1] << 16 | (unsigned long long)q.bits[2] << 32);
+}
+
+template<class T>
+unsigned long long pack_quat64(const quat_t<T>& q) {
+    return quat_encode_smallest3<20>(q);
+}
+
+template<class T>
+quat_t<T> unpack_quat64(unsigned long long bits) {
+    return quat_decode_smallest3<20, T>(bits);
+}
+
+// Array versions
+template<class T>
+void pack_quats32(unsigned int* out, const quat_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = pack_quat32(in[i]);
+    }
+}
+
+template<class T>
+void unpack_quats32(quat_t<T>* out, const unsigned int* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = unpack_quat32<T>(in[i]);
+    }
+}
+
+template<class T>
+void pack_quats48(quat48_t* out, const quat_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = pack_quat48(in[i]);
+    }
+}
+
+template<class T>
+void unpack_quats48(quat_t<T>* out, const quat48_t* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = unpack_quat48<T>(in[i]);
+    }
+}
+
+template<class T>
+void pack_quats64(unsigned long long* out, const quat_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = pack_quat64(in[i]);
+    }
+}
+
+template<class T>
+void unpack_quats64(quat_t<T>* out, const unsigned long long* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = unpack_quat64<T>(in[i]);
+    }
+}
+
+#if defined(ZMATH_SIMD)
+// Four quaternions at a time, transposed so that every lane holds one of them.
+// The largest component and the three others are picked with selects instead
+// of branches; only the final bit assembly of the 48 and 64 bit formats, which
+// do not fit 32-bit lanes, is scalar.
+template<int B>
+inline void quat_encode_smallest3(const quat_t<float>* q, simd4i& largest, simd4i& a, simd4i& b, simd4i& c) {
+    auto x = simd_load(&q[0].x);
+    auto y = simd_load(&q[1].x);
+    auto z = simd_load(&q[2].x);
+    auto w = simd_load(&q[3].x);
+    simd_transpose(x, y, z, w);
+
+    auto ax = simd_abs(x), ay = simd_abs(y), az = simd_abs(z), aw = simd_abs(w);
+    auto m = simd_max(simd_max(ax, ay), simd_max(az, aw));
+
+    // The first component equal to the maximum wins, as in the scalar version
+    auto e0 = simd_cmpge(ax, m);
+    auto e1 = simd_or(e0, simd_cmpge(ay, m)); // largest <= 1
+    auto e2 = simd_or(e1, simd_cmpge(az, m)); // largest <= 2
+
+    auto l = simd_select(e0, x, simd_select(e1, y, simd_select(e2, z, w)));
+    auto one = simd_splat(1.0f);
+    auto sign = simd_select(simd_cmplt(l, simd_zero()), simd_sub(simd_zero(), one), one);
+    auto zeroCode = float((1u << B) / 2 - 1);
+    auto scale = simd_splat(1.4142135623730951f * zeroCode);
+    auto offset = simd_splat(zeroCode + 0.5f);
+    auto limit = simd_splat(zeroCode * 2);
+
+    simd4f v[3] = {
+        simd_select(e0, y, x),
+        simd_select(e1, z, y),
+        simd_select(e2, w, z),
+    };
+    simd4i u[3];
+
+    // Not simd_madd: a fused multiply-add would round differently from the
+    // scalar version and move some codes by one
+    for (int i = 0; i < 3; ++i) {
+        auto t = simd_add(simd_mul(simd_mul(v[i], sign), scale), offset);
+        u[i] = simd_ftoi(simd_min(simd_max(t, simd_zero()), limit));
+    }
+
+    largest = simd_ftoi(simd_select(e0, simd_zero(), simd_select(e1, one, simd_select(e2, simd_splat(2.0f), simd_splat(3.0f)))));
+    a = u[0];
+    b = u[1];
+    c = u[2];
+}
+
+template<int B>
+inline void quat_decode_smallest3(simd4i largest, simd4i a, simd4i b, simd4i c, quat_t<float>* q) {
+    auto zeroCode = float((1u << B) / 2 - 1);
+    auto zero = simd_splat(zeroCode);
+    auto scale = simd_splat(0.7071067811865476f / zeroCode);
+    auto one = simd_splat(1.0f);
+    auto va = simd_mul(simd_sub(simd_itof(a), zero), scale);
+    auto vb = simd_mul(simd_sub(simd_itof(b), zero), scale);
+    auto vc = simd_mul(simd_sub(simd_itof(c), zero), scale);
+    auto sum = simd_madd(va, va, simd_madd(vb, vb, simd_mul(vc, vc)));
+    auto l = simd_sqrt(simd_max(simd_sub(one, sum), simd_zero()));
+
+    auto index = simd_itof(largest);
+    auto e0 = simd_cmplt(index, simd_splat(0.5f));
+    auto e1 = simd_cmplt(index, simd_splat(1.5f));
+    auto e2 = simd_cmplt(index, simd_splat(2.5f));
+
+    auto x = simd_select(e0, l, va);
+    auto y = simd_select(e0, va, simd_select(e1, l, vb));
+    auto z = simd_select(e1, vb, simd_select(e2, l, vc));
+    auto w = simd_select(e2, vc, l);
+    simd_transpose(x, y, z, w);
+
+    simd_store(&q[0].x, x);
+    simd_store(&q[1].x, y);
+    simd_store(&q[2].x, z);
+    simd_store(&q[3].x, w);
+}
+
+template<>
+inline void pack_quats32(unsigned int* out, const quat_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4i largest, a, b, c;
+        quat_encode_smallest3<10>(in + i * 4, largest, a, b, c);
+        auto bits = simd_ori(simd_ori(largest, simd_shli<2>(a)), simd_ori(simd_shli<12>(b), simd_shli<22>(c)));
+        simd_storei(out + i * 4, bits);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = pack_quat32(in[i]);
+    }
+}
+
+template<>
+inline void unpack_quats32(quat_t<float>* out, const unsigned int* in, size_t count) {
+    auto blocks = count / 4;
+    auto mask = simd_splati(1023);
+
+    for (size_t i = 0; i < blocks; ++i) {
+        auto bits = simd_loadi(in + i * 4);
+        quat_decode_smallest3<10>(simd_andi(bits, simd_splati(3)),
+                                  simd_andi(simd_shri<2>(bits), mask),
+                                  simd_andi(simd_shri<12>(bits), mask),
+                                  simd_shri<22>(bits),
+                                  out + i * 4);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = unpack_quat32<float>(in[i]);
+    }
+}
+
+template<>
+inline void pack_quats48(quat48_t* out, const quat_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4i largest, a, b, c;
+        unsigned int l[4], u[3][4];
+        quat_encode_smallest3<15>(in + i * 4, largest, a, b, c);
+        simd_storei(l, largest);
+        simd_storei(u[0], a);
+        simd_storei(u[1], b);
+        simd_storei(u[2], c);
+
+        for (int k = 0; k < 4; ++k) {
+            auto bits = l[k] | (unsigned long long)u[0][k] << 2 | (unsigned long long)u[1][k] << 17 | (unsigned long long)u[2][k] << 32;
+            auto& r = out[i * 4 + k];
+            r.bits[0] = (unsigned short)bits;
+            r.bits[1] = (unsigned short)(bits >> 16);
+            r.bits[2] = (unsigned short)(bits >> 32);
+        }
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = pack_quat48(in[i]);
+    }
+}
+
+template<>
+inline void unpack_quats48(quat_t<float>* out, const quat48_t* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        unsigned int l[4], u[3][4];
+
+        for (int k = 0; k < 4; ++k) {
+            auto& p = in[i * 4 + k];
+            auto bits = p.bits[0] | (unsigned long long)p.bits[1] << 16 | (unsigned long long)p.bits[2] << 32;
+            l[k] = (unsigned int)(bits & 3);
+            u[0][k] = (unsigned int)(bits >> 2) & 0x7fff;
+            u[1][k] = (unsigned int)(bits >> 17) & 0x7fff;
+            u[2][k] = (unsigned int)(bits >> 32) & 0x7fff;
+        }
+
+        quat_decode_smallest3<15>(simd_loadi(l), simd_loadi(u[0]), simd_loadi(u[1]), simd_loadi(u[2]), out + i * 4);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = unpack_quat48<float>(in[i]);
+    }
+}
+
+template<>
+inline void pack_quats64(unsigned long long* out, const quat_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4i largest, a, b, c;
+        unsigned int l[4], u[3][4];
+        quat_encode_smallest3<20>(in + i * 4, largest, a, b, c);
+        simd_storei(l, largest);
+        simd_storei(u[0], a);
+        simd_storei(u[1], b);
+        simd_storei(u[2], c);
+
+        for (int k = 0; k < 4; ++k) {
+            out[i * 4 + k] = l[k] | (unsigned long long)u[0][k] << 2 | (unsigned long long)u[1][k] << 22 | (unsigned long long)u[2][k] << 42;
+        }
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = pack_quat64(in[i]);
+    }
+}
+
+template<>
+inline void unpack_quats64(quat_t<float>* out, const unsigned long long* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        unsigned int l[4], u[3][4];
+
+        for (int k = 0; k < 4; ++k) {
+            auto bits = in[i * 4 + k];
+            l[k] = (unsigned int)(bits & 3);
+            u[0][k] = (unsigned int)(bits >> 2) & 0xfffff;
+            u[1][k] = (unsigned int)(bits >> 22) & 0xfffff;
+            u[2][k] = (unsigned int)(bits >> 42) & 0xfffff;
+        }
+
+        quat_decode_smallest3<20>(simd_loadi(l), simd_loadi(u[0]), simd_loadi(u[1]), simd_loadi(u[2]), out + i * 4);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = unpack_quat64<float>(in[i]);
+    }
+}
+#endif
@@ -28,6 +28,8 @@ struct ray_t {
 
     ray_t() {}
     ray_t(const vec3_t<T>& pos, const vec3_t<T>& dir) : dir(dir), pos(pos) {}
+    template<class U>
+    explicit ray_t(const ray_t<U>& r) : dir(r.dir), pos(r.pos) {}
 
     bool operator == (const ray_t& r) const {
         return pos == r.pos && dir == r.dir;
@@ -58,3 +60,275 @@ ray_t<T> unproject(int x, int y, int w, int h, const mat4x4_t<T>& invView, const
 
     return ray_t<T>(pos, normalize(dir));
 }
+
+// Intersection queries. Hits are reported only in front of the ray origin
+// (t >= 0); t is measured in units of dir, which therefore need not be
+// normalized. There are no epsilon tests, since the determinants involved
+// scale with |dir| and the size of the primitive: only exactly parallel rays
+// miss, and near-parallel ones hit as long as t stays finite.
+
+template<class T>
+bool intersect_plane(const ray_t<T>& r, const plane_t<T>& p, T& t) {
+    auto denom = dot(p.normal, r.dir);
+
+    if (denom == 0) {
+        return false;
+    }
+
+    t = -dot(p, r.pos) / denom;
+    return t >= 0 && t <= std::numeric_limits<T>::max();
+}
+
+// Nearest hit, or the exit point when the origin is inside the sphere
+template<class T>
+bool intersect_sphere(const ray_t<T>& r, const vec3_t<T>& center, T radius, T& t) {
+    auto m = r.pos - center;
+    auto a = dot(r.dir, r.dir);
+    auto b = dot(m, r.dir);
+    auto c = dot(m, m) - radius * radius;
+    auto disc = b * b - a * c;
+
+    if (disc < 0) {
+        return false;
+    }
+
+    auto s = sqrt(disc);
+    t = (-b - s) / a;
+
+    if (t < 0) {
+        t = (-b + s) / a;
+    }
+
+    return t >= 0;
+}
+
+// Slab test against [0, tMax]. invDir is 1 / dir per component (infinities for
+// axis-parallel rays are fine), so it can be computed once per ray and reused
+// for every box. t is the entry distance, 0 when the origin is inside.
+template<class T>
+bool intersect_aabb(const vec3_t<T>& pos, const vec3_t<T>& invDir, const aabb_t<T>& box, T tMax, T& t) {
+    auto t1 = (box.min - pos) * invDir;
+    auto t2 = (box.max - pos) * invDir;
+    auto lo = minimize(t1, t2);
+    auto hi = maximize(t1, t2);
+    auto tNear = (lo.x > lo.y) ? lo.x : lo.y;
+    auto tFar = (hi.x < hi.y) ? hi.x : hi.y;
+    tNear = (lo.z > tNear) ? lo.z : tNear;
+    tFar = (hi.z < tFar) ? hi.z : tFar;
+    tNear = (tNear > 0) ? tNear : 0;
+    tFar = (tFar < tMax) ? tFar : tMax;
+
+    if (tNear > tFar) {
+        return false;
+    }
+
+    t = tNear;
+    return true;
+}
+
+template<class T>
+bool intersect_aabb(const ray_t<T>& r, const aabb_t<T>& box, T& t) {
+    vec3_t<T> invDir(1 / r.dir.x, 1 / r.dir.y, 1 / r.dir.z);
+    return intersect_aabb(r.pos, invDir, box, std::numeric_limits<T>::max(), t);
+}
+
+// Möller–Trumbore, two-sided. u and v are the barycentric weights of p1 and p2.
+template<class T>
+bool intersect_triangle(const ray_t<T>& r, const vec3_t<T>& p0, const vec3_t<T>& p1, const vec3_t<T>& p2,
+                        T& t, T& u, T& v) {
+    auto e1 = p1 - p0;
+    auto e2 = p2 - p0;
+    auto pv = cross(r.dir, e2);
+    auto det = dot(e1, pv);
+
+    if (det == 0) {
+        return false;
+    }
+
+    // An infinite invDet makes u, v or t infinite or NaN, which fail below
+    auto invDet = 1 / det;
+    auto tv = r.pos - p0;
+    u = dot(tv, pv) * invDet;
+
+    if (u < 0 || u > 1) {
+        return false;
+    }
+
+    auto qv = cross(tv, e1);
+    v = dot(r.dir, qv) * invDet;
+
+    if (v < 0 || u + v > 1) {
+        return false;
+    }
+
+    t = dot(e2, qv) * invDet;
+    return t >= 0;
+}
+
+// Four rays in SoA layout for packet queries. The packet variants return a
+// mask with bit i set when ray i hits, and fill the output arrays for every
+// lane (values of missing lanes are unspecified).
+template<class T>
+struct ray4_t {
+    T px[4], py[4], pz[4];
+    T dx[4], dy[4], dz[4];
+    T ix[4], iy[4], iz[4]; // 1 / dir
+
+    ray4_t() {}
+
+    explicit ray4_t(const ray_t<T>* rays) {
+        for (int i = 0; i < 4; ++i) {
+            set(i, rays[i]);
+        }
+    }
+
+    ray_t<T> get(int i) const {
+        return ray_t<T>(vec3_t<T>(px[i], py[i], pz[i]), vec3_t<T>(dx[i], dy[i], dz[i]));
+    }
+
+    void set(int i, const ray_t<T>& r) {
+        px[i] = r.pos.x; py[i] = r.pos.y; pz[i] = r.pos.z;
+        dx[i] = r.dir.x; dy[i] = r.dir.y; dz[i] = r.dir.z;
+        ix[i] = 1 / r.dir.x; iy[i] = 1 / r.dir.y; iz[i] = 1 / r.dir.z;
+    }
+};
+
+template<class T>
+int intersect_plane(const ray4_t<T>& r, const plane_t<T>& p, T* t) {
+    int mask = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        mask |= intersect_plane(r.get(i), p, t[i]) << i;
+    }
+
+    return mask;
+}
+
+template<class T>
+int intersect_sphere(const ray4_t<T>& r, const vec3_t<T>& center, T radius, T* t) {
+    int mask = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        mask |= intersect_sphere(r.get(i), center, radius, t[i]) << i;
+    }
+
+    return mask;
+}
+
+// tMax holds one limit per ray
+template<class T>
+int intersect_aabb(const ray4_t<T>& r, const aabb_t<T>& box, const T* tMax, T* t) {
+    int mask = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        vec3_t<T> pos(r.px[i], r.py[i], r.pz[i]);
+        vec3_t<T> invDir(r.ix[i], r.iy[i], r.iz[i]);
+        mask |= intersect_aabb(pos, invDir, box, tMax[i], t[i]) << i;
+    }
+
+    return mask;
+}
+
+template<class T>
+int intersect_triangle(const ray4_t<T>& r, const vec3_t<T>& p0, const vec3_t<T>& p1, const vec3_t<T>& p2,
+                       T* t, T* u, T* v) {
+    int mask = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        mask |= intersect_triangle(r.get(i), p0, p1, p2, t[i], u[i], v[i]) << i;
+    }
+
+    return mask;
+}
+
+#if defined(ZMATH_SIMD)
+template<>
+inline int intersect_plane(const ray4_t<float>& r, const plane_t<float>& p, float* t) {
+    auto nx = simd_splat(p.normal.x);
+    auto ny = simd_splat(p.normal.y);
+    auto nz = simd_splat(p.normal.z);
+    auto denom = simd_madd(nx, simd_load(r.dx), simd_madd(ny, simd_load(r.dy), simd_mul(nz, simd_load(r.dz))));
+    auto dist = simd_madd(nx, simd_load(r.px), simd_madd(ny, simd_load(r.py), simd_madd(nz, simd_load(r.pz), simd_splat(p.dist))));
+    auto tt = simd_div(simd_sub(simd_zero(), dist), denom);
+    // denom == 0 gives an infinite or NaN t, which fails the range test
+    auto hit = simd_and(simd_cmpge(tt, simd_zero()), simd_cmple(tt, simd_splat(std::numeric_limits<float>::max())));
+    simd_store(t, tt);
+    return simd_mask(hit);
+}
+
+template<>
+inline int intersect_sphere(const ray4_t<float>& r, const vec3_t<float>& center, float radius, float* t) {
+    auto dx = simd_load(r.dx), dy = simd_load(r.dy), dz = simd_load(r.dz);
+    auto mx = simd_sub(simd_load(r.px), simd_splat(center.x));
+    auto my = simd_sub(simd_load(r.py), simd_splat(center.y));
+    auto mz = simd_sub(simd_load(r.pz), simd_splat(center.z));
+    auto a = simd_madd(dx, dx, simd_madd(dy, dy, simd_mul(dz, dz)));
+    auto b = simd_madd(mx, dx, simd_madd(my, dy, simd_mul(mz, dz)));
+    auto c = simd_sub(simd_madd(mx, mx, simd_madd(my, my, simd_mul(mz, mz))), simd_splat(radius * radius));
+    auto disc = simd_sub(simd_mul(b, b), simd_mul(a, c));
+    auto s = simd_sqrt(simd_max(disc, simd_zero()));
+    auto nb = simd_sub(simd_zero(), b);
+    auto t0 = simd_div(simd_sub(nb, s), a);
+    auto t1 = simd_div(simd_add(nb, s), a);
+    auto tt = simd_select(simd_cmpge(t0, simd_zero()), t0, t1);
+    auto hit = simd_and(simd_cmpge(disc, simd_zero()), simd_cmpge(tt, simd_zero()));
+    simd_store(t, tt);
+    return simd_mask(hit);
+}
+
+template<>
+inline int intersect_aabb(const ray4_t<float>& r, const aabb_t<float>& box, const float* tMax, float* t) {
+    auto px = simd_load(r.px), py = simd_load(r.py), pz = simd_load(r.pz);
+    auto ix = simd_load(r.ix), iy = simd_load(r.iy), iz = simd_load(r.iz);
+    auto x1 = simd_mul(simd_sub(simd_splat(box.min.x), px), ix);
+    auto x2 = simd_mul(simd_sub(simd_splat(box.max.x), px), ix);
+    auto y1 = simd_mul(simd_sub(simd_splat(box.min.y), py), iy);
+    auto y2 = simd_mul(simd_sub(simd_splat(box.max.y), py), iy);
+    auto z1 = simd_mul(simd_sub(simd_splat(box.min.z), pz), iz);
+    auto z2 = simd_mul(simd_sub(simd_splat(box.max.z), pz), iz);
+    auto tNear = simd_max(simd_max(simd_min(x1, x2), simd_min(y1, y2)), simd_max(simd_min(z1, z2), simd_zero()));
+    auto tFar = simd_min(simd_min(simd_max(x1, x2), simd_max(y1, y2)), simd_min(simd_max(z1, z2), simd_load(tMax)));
+    simd_store(t, tNear);
+    return simd_mask(simd_cmple(tNear, tFar));
+}
+
+template<>
+inline int intersect_triangle(const ray4_t<float>& r, const vec3_t<float>& p0, const vec3_t<float>& p1, const vec3_t<float>& p2,
+                              float* t, float* u, float* v) {
+    auto zero = simd_zero();
+    auto one = simd_splat(1.0f);
+    auto e1 = p1 - p0;
+    auto e2 = p2 - p0;
+    auto e1x = simd_splat(e1.x), e1y = simd_splat(e1.y), e1z = simd_splat(e1.z);
+    auto e2x = simd_splat(e2.x), e2y = simd_splat(e2.y), e2z = simd_splat(e2.z);
+    auto dx = simd_load(r.dx), dy = simd_load(r.dy), dz = simd_load(r.dz);
+
+    // pv = cross(dir, e2)
+    auto pvx = simd_sub(simd_mul(dy, e2z), simd_mul(dz, e2y));
+    auto pvy = simd_sub(simd_mul(dz, e2x), simd_mul(dx, e2z));
+    auto pvz = simd_sub(simd_mul(dx, e2y), simd_mul(dy, e2x));
+    auto det = simd_madd(e1x, pvx, simd_madd(e1y, pvy, simd_mul(e1z, pvz)));
+    auto invDet = simd_div(one, det);
+
+    // tv = pos - p0, qv = cross(tv, e1)
+    auto tx = simd_sub(simd_load(r.px), simd_splat(p0.x));
+    auto ty = simd_sub(simd_load(r.py), simd_splat(p0.y));
+    auto tz = simd_sub(simd_load(r.pz), simd_splat(p0.z));
+    auto qx = simd_sub(simd_mul(ty, e1z), simd_mul(tz, e1y));
+    auto qy = simd_sub(simd_mul(tz, e1x), simd_mul(tx, e1z));
+    auto qz = simd_sub(simd_mul(tx, e1y), simd_mul(ty, e1x));
+
+    auto uu = simd_mul(simd_madd(tx, pvx, simd_madd(ty, pvy, simd_mul(tz, pvz))), invDet);
+    auto vv = simd_mul(simd_madd(dx, qx, simd_madd(dy, qy, simd_mul(dz, qz))), invDet);
+    auto tt = simd_mul(simd_madd(e2x, qx, simd_madd(e2y, qy, simd_mul(e2z, qz))), invDet);
+
+    // det == 0 gives infinite or NaN weights, which fail the tests below
+    auto hit = simd_and(simd_cmpge(uu, zero), simd_cmpge(vv, zero));
+    hit = simd_and(hit, simd_and(simd_cmple(simd_add(uu, vv), one), simd_cmpge(tt, zero)));
+
+    simd_store(t, tt);
+    simd_store(u, uu);
+    simd_store(v, vv);
+    return simd_mask(hit);
+}
+#endif
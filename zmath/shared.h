@@ -21,7 +21,7 @@
 //
 #pragma once
 
-static const double PI = 3.141592653589793238463;
+static ZMATH_CONSTEXPR const double PI = 3.141592653589793238463;
 
 template<class T>
 bool float_eq(T a, T b, T maxError = 1e-6) {
@@ -42,50 +42,100 @@ bool float_eq(T a, T b, T maxError = 1e-6) {
 }
 
 template<class T>
-T sqr(T x) {
+ZMATH_CONSTEXPR T sqr(T x) {
     return x * x;
 }
 
+// 1 / sqrt(x); the float version uses the SIMD estimate, see simd_rsqrt. Its
+// relative error is below 3e-7, so the lengths of vectors scaled by it, as in
+// normalize_fast, are within 3e-7 of one.
 template<class T>
-T radians(T x) {
+T rsqrt_fast(T x) {
+    return 1 / sqrt(x);
+}
+
+// Sine and cosine of one angle. With ZMATH_FAST_TRIG defined the float
+// version is sincos_fast; the macro must be the same in every translation
+// unit, including zmath.cpp, which the ZMATH_FAST_TRIG CMake option ensures.
+template<class T>
+void sincos(T x, T& s, T& c) {
+    s = sin(x);
+    c = cos(x);
+}
+
+// Polynomial sine and cosine: x is reduced by pi/2 in three parts and both
+// minimax polynomials are evaluated on [-pi/4, pi/4], so the result is single
+// precision whatever T is. For |x| < 8192 the absolute error is below 1e-7
+// (9.2e-8 measured). The relative error is not bounded in ulp: it grows near
+// the zeros, to about 120 ulp close to multiples of pi near |x| = 6200. The
+// float version runs on SIMD, see simd_sincos.
+template<class T>
+void sincos_fast(T x, T& s, T& c) {
+    T j = floor(x * T(2 / PI) + T(0.5));
+    auto r = ((x - j * T(1.5703125)) - j * T(4.837512969970703125e-4)) - j * T(7.54978995489188216e-8);
+    auto z = r * r;
+    auto ps = r + r * z * (T(-1.6666654611e-1) + z * (T(8.3321608736e-3) + z * T(-1.9515295891e-4)));
+    auto pc = 1 - z / 2 + z * z * (T(4.166664568298827e-2) + z * (T(-1.388731625493765e-3) + z * T(2.443315711809948e-5)));
+
+    // Quadrant: swap for odd, negate the sine in 2 and 3, the cosine in 1 and 2
+    auto q = (long long)j & 3;
+    s = (q & 1) ? pc : ps;
+    c = (q & 1) ? ps : pc;
+    if (q & 2) {
+        s = -s;
+    }
+    if ((q + 1) & 2) {
+        c = -c;
+    }
+}
+
+template<class T>
+void sincos_fast(T* s, T* c, const T* x, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        sincos_fast(x[i], s[i], c[i]);
+    }
+}
+
+template<class T>
+ZMATH_CONSTEXPR T radians(T x) {
     return x * (T)PI / (T)180;
 }
 
 template<class T>
-T degrees(T x) {
+ZMATH_CONSTEXPR T degrees(T x) {
     return x * 180 / (T)PI;
 }
 
 template<class T>
-bool ispow2(T x) {
+ZMATH_CONSTEXPR bool ispow2(T x) {
     return x != 0 && (x & (x-1)) == 0;
 }
 
 template<class T>
-T lerp(T min, T max, T scale) {
+ZMATH_CONSTEXPR T lerp(T min, T max, T scale) {
     return min + (max - min) * scale;
 }
 
 template<class T>
-T clamp(T value, T min, T max) {
+ZMATH_CONSTEXPR T clamp(T value, T min, T max) {
     return (value < min) ? min : ((value > max) ? max : value);
 }
 
 template<class T>
-T saturate(T x) {
+ZMATH_CONSTEXPR T saturate(T x) {
     return (x < 0) ? 0 : ((x > 1) ? 1 : x);
 }
 
 template<class T>
-T det2x2(T m11, T m12,
-         T m21, T m22) {
+ZMATH_CONSTEXPR T det2x2(T m11, T m12,
+                         T m21, T m22) {
     return m11 * m22 - m21 * m12;
 }
 
 template<class T>
-T det3x3(T m11, T m12, T m13,
-         T m21, T m22, T m23,
-         T m31, T m32, T m33) {
+ZMATH_CONSTEXPR T det3x3(T m11, T m12, T m13,
+                         T m21, T m22, T m23,
+                         T m31, T m32, T m33) {
     return m11 * det2x2(m22, m23,
                         m32, m33)
 
@@ -97,10 +147,10 @@ T det3x3(T m11, T m12, T m13,
 }
 
 template<class T>
-T det4x4(T m11, T m12, T m13, T m14,
-         T m21, T m22, T m23, T m24,
-         T m31, T m32, T m33, T m34,
-         T m41, T m42, T m43, T m44) {
+ZMATH_CONSTEXPR T det4x4(T m11, T m12, T m13, T m14,
+                         T m21, T m22, T m23, T m24,
+                         T m31, T m32, T m33, T m34,
+                         T m41, T m42, T m43, T m44) {
     return m11 * det3x3(m22, m23, m24,
                         m32, m33, m34,
                         m42, m43, m44)
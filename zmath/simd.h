@@ -0,0 +1,578 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// Backend selection. Define ZMATH_NO_SIMD to build the generic code only.
+#if !defined(ZMATH_NO_SIMD)
+#  if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define ZMATH_SIMD_NEON
+#    if defined(__aarch64__) || (defined(__ARM_FP) && (__ARM_FP & 2))
+#      define ZMATH_SIMD_F16
+#    endif
+#  elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define ZMATH_SIMD_SSE
+#    if defined(__AVX__)
+#      define ZMATH_SIMD_AVX
+#    endif
+#    if defined(__FMA__)
+#      define ZMATH_SIMD_FMA
+#    endif
+#    if defined(__F16C__)
+#      define ZMATH_SIMD_F16
+#    endif
+#  endif
+#endif
+
+#if defined(ZMATH_SIMD_SSE)
+#define ZMATH_SIMD
+
+#if defined(ZMATH_SIMD_AVX) || defined(ZMATH_SIMD_FMA) || defined(ZMATH_SIMD_F16)
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+typedef __m128 simd4f;
+typedef __m128 simd4m;
+
+inline simd4f simd_load(const float* p) {
+    return _mm_loadu_ps(p);
+}
+
+inline void simd_store(float* p, simd4f v) {
+    _mm_storeu_ps(p, v);
+}
+
+inline void simd_store3(float* p, simd4f v) {
+    _mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+    _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+}
+
+inline simd4f simd_splat(float f) {
+    return _mm_set1_ps(f);
+}
+
+inline simd4f simd_zero() {
+    return _mm_setzero_ps();
+}
+
+inline simd4f simd_add(simd4f a, simd4f b) {
+    return _mm_add_ps(a, b);
+}
+
+inline simd4f simd_sub(simd4f a, simd4f b) {
+    return _mm_sub_ps(a, b);
+}
+
+inline simd4f simd_mul(simd4f a, simd4f b) {
+    return _mm_mul_ps(a, b);
+}
+
+inline simd4f simd_div(simd4f a, simd4f b) {
+    return _mm_div_ps(a, b);
+}
+
+// a * b + c
+inline simd4f simd_madd(simd4f a, simd4f b, simd4f c) {
+#if defined(ZMATH_SIMD_FMA)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+inline simd4f simd_min(simd4f a, simd4f b) {
+    return _mm_min_ps(a, b);
+}
+
+inline simd4f simd_max(simd4f a, simd4f b) {
+    return _mm_max_ps(a, b);
+}
+
+inline simd4f simd_sqrt(simd4f v) {
+    return _mm_sqrt_ps(v);
+}
+
+// Estimate plus one Newton-Raphson step, relative error below 3e-7.
+// Zero gives NaN.
+inline simd4f simd_rsqrt(simd4f v) {
+    auto r = _mm_rsqrt_ps(v);
+    auto vr = _mm_mul_ps(v, r);
+    return _mm_mul_ps(_mm_mul_ps(r, _mm_set1_ps(0.5f)), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(vr, r)));
+}
+
+inline simd4m simd_cmpgt(simd4f a, simd4f b) {
+    return _mm_cmpgt_ps(a, b);
+}
+
+inline simd4m simd_cmplt(simd4f a, simd4f b) {
+    return _mm_cmplt_ps(a, b);
+}
+
+inline simd4m simd_cmpge(simd4f a, simd4f b) {
+    return _mm_cmpge_ps(a, b);
+}
+
+inline simd4m simd_cmple(simd4f a, simd4f b) {
+    return _mm_cmple_ps(a, b);
+}
+
+inline simd4m simd_and(simd4m a, simd4m b) {
+    return _mm_and_ps(a, b);
+}
+
+inline simd4m simd_or(simd4m a, simd4m b) {
+    return _mm_or_ps(a, b);
+}
+
+inline simd4f simd_abs(simd4f v) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+}
+
+// mask ? a : b
+inline simd4f simd_select(simd4m mask, simd4f a, simd4f b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+inline bool simd_any(simd4m mask) {
+    return _mm_movemask_ps(mask) != 0;
+}
+
+// One bit per lane, lane 0 in bit 0
+inline int simd_mask(simd4m mask) {
+    return _mm_movemask_ps(mask);
+}
+
+inline float simd_hadd(simd4f v) {
+    auto t = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    t = _mm_add_ss(t, _mm_shuffle_ps(t, t, 1));
+    return _mm_cvtss_f32(t);
+}
+
+inline simd4f simd_set(float x, float y, float z, float w) {
+    return _mm_setr_ps(x, y, z, w);
+}
+
+inline float simd_get_x(simd4f v) {
+    return _mm_cvtss_f32(v);
+}
+
+// (a[x], a[y], b[z], b[w])
+template<int x, int y, int z, int w>
+inline simd4f simd_shuffle(simd4f a, simd4f b) {
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x));
+}
+
+// Swizzles
+inline simd4f simd_wzyx(simd4f v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3)); }
+inline simd4f simd_zwxy(simd4f v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)); }
+inline simd4f simd_yxwz(simd4f v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)); }
+inline simd4f simd_wwww(simd4f v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)); }
+
+// Unsigned 32-bit lanes, for bit packing. Float conversions truncate and
+// expect values in [0, 2^31).
+typedef __m128i simd4i;
+
+inline simd4i simd_loadi(const unsigned int* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline void simd_storei(unsigned int* p, simd4i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+
+inline simd4i simd_splati(unsigned int i) {
+    return _mm_set1_epi32((int)i);
+}
+
+inline simd4i simd_ftoi(simd4f v) {
+    return _mm_cvttps_epi32(v);
+}
+
+inline simd4f simd_itof(simd4i v) {
+    return _mm_cvtepi32_ps(v);
+}
+
+inline simd4i simd_andi(simd4i a, simd4i b) {
+    return _mm_and_si128(a, b);
+}
+
+inline simd4i simd_ori(simd4i a, simd4i b) {
+    return _mm_or_si128(a, b);
+}
+
+template<int n>
+inline simd4i simd_shli(simd4i v) {
+    return _mm_slli_epi32(v, n);
+}
+
+template<int n>
+inline simd4i simd_shri(simd4i v) {
+    return _mm_srli_epi32(v, n);
+}
+
+#elif defined(ZMATH_SIMD_NEON)
+#define ZMATH_SIMD
+
+#include <arm_neon.h>
+
+typedef float32x4_t simd4f;
+typedef uint32x4_t  simd4m;
+
+inline simd4f simd_load(const float* p) {
+    return vld1q_f32(p);
+}
+
+inline void simd_store(float* p, simd4f v) {
+    vst1q_f32(p, v);
+}
+
+inline void simd_store3(float* p, simd4f v) {
+    vst1_f32(p, vget_low_f32(v));
+    vst1q_lane_f32(p + 2, v, 2);
+}
+
+inline simd4f simd_splat(float f) {
+    return vdupq_n_f32(f);
+}
+
+inline simd4f simd_zero() {
+    return vdupq_n_f32(0);
+}
+
+inline simd4f simd_add(simd4f a, simd4f b) {
+    return vaddq_f32(a, b);
+}
+
+inline simd4f simd_sub(simd4f a, simd4f b) {
+    return vsubq_f32(a, b);
+}
+
+inline simd4f simd_mul(simd4f a, simd4f b) {
+    return vmulq_f32(a, b);
+}
+
+inline simd4f simd_div(simd4f a, simd4f b) {
+#if defined(__aarch64__)
+    return vdivq_f32(a, b);
+#else
+    auto r = vrecpeq_f32(b);
+    r = vmulq_f32(r, vrecpsq_f32(b, r));
+    r = vmulq_f32(r, vrecpsq_f32(b, r));
+    return vmulq_f32(a, r);
+#endif
+}
+
+// a * b + c
+inline simd4f simd_madd(simd4f a, simd4f b, simd4f c) {
+#if defined(__aarch64__)
+    return vfmaq_f32(c, a, b);
+#else
+    return vmlaq_f32(c, a, b);
+#endif
+}
+
+inline simd4f simd_min(simd4f a, simd4f b) {
+    return vminq_f32(a, b);
+}
+
+inline simd4f simd_max(simd4f a, simd4f b) {
+    return vmaxq_f32(a, b);
+}
+
+inline simd4f simd_sqrt(simd4f v) {
+#if defined(__aarch64__)
+    return vsqrtq_f32(v);
+#else
+    // v * rsqrt(v), with zero inputs mapped to zero instead of NaN
+    auto r = vrsqrteq_f32(v);
+    r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(v, r), r));
+    r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(v, r), r));
+    return vbslq_f32(vceqq_f32(v, vdupq_n_f32(0)), v, vmulq_f32(v, r));
+#endif
+}
+
+// The NEON estimate has 8 bits, so it takes two steps to match SSE.
+// Zero gives NaN.
+inline simd4f simd_rsqrt(simd4f v) {
+    auto r = vrsqrteq_f32(v);
+    r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(v, r), r));
+    return vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(v, r), r));
+}
+
+inline simd4m simd_cmpgt(simd4f a, simd4f b) {
+    return vcgtq_f32(a, b);
+}
+
+inline simd4m simd_cmplt(simd4f a, simd4f b) {
+    return vcltq_f32(a, b);
+}
+
+inline simd4m simd_cmpge(simd4f a, simd4f b) {
+    return vcgeq_f32(a, b);
+}
+
+inline simd4m simd_cmple(simd4f a, simd4f b) {
+    return vcleq_f32(a, b);
+}
+
+inline simd4m simd_and(simd4m a, simd4m b) {
+    return vandq_u32(a, b);
+}
+
+inline simd4m simd_or(simd4m a, simd4m b) {
+    return vorrq_u32(a, b);
+}
+
+inline simd4f simd_abs(simd4f v) {
+    return vabsq_f32(v);
+}
+
+// mask ? a : b
+inline simd4f simd_select(simd4m mask, simd4f a, simd4f b) {
+    return vbslq_f32(mask, a, b);
+}
+
+inline bool simd_any(simd4m mask) {
+#if defined(__aarch64__)
+    return vmaxvq_u32(mask) != 0;
+#else
+    auto t = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+    return vget_lane_u32(vpmax_u32(t, t), 0) != 0;
+#endif
+}
+
+// One bit per lane, lane 0 in bit 0
+inline int simd_mask(simd4m mask) {
+    static const uint32_t bits[4] = { 1, 2, 4, 8 };
+    auto t = vandq_u32(mask, vld1q_u32(bits));
+#if defined(__aarch64__)
+    return (int)vaddvq_u32(t);
+#else
+    auto h = vorr_u32(vget_low_u32(t), vget_high_u32(t));
+    return (int)vget_lane_u32(vpadd_u32(h, h), 0);
+#endif
+}
+
+inline float simd_hadd(simd4f v) {
+#if defined(__aarch64__)
+    return vaddvq_f32(v);
+#else
+    auto t = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(t, t), 0);
+#endif
+}
+
+inline simd4f simd_set(float x, float y, float z, float w) {
+    const float p[4] = { x, y, z, w };
+    return vld1q_f32(p);
+}
+
+inline float simd_get_x(simd4f v) {
+    return vgetq_lane_f32(v, 0);
+}
+
+// (a[x], a[y], b[z], b[w])
+template<int x, int y, int z, int w>
+inline simd4f simd_shuffle(simd4f a, simd4f b) {
+    auto r = vdupq_n_f32(vgetq_lane_f32(a, x));
+    r = vsetq_lane_f32(vgetq_lane_f32(a, y), r, 1);
+    r = vsetq_lane_f32(vgetq_lane_f32(b, z), r, 2);
+    return vsetq_lane_f32(vgetq_lane_f32(b, w), r, 3);
+}
+
+// Swizzles
+inline simd4f simd_wzyx(simd4f v) { auto t = vrev64q_f32(v); return vextq_f32(t, t, 2); }
+inline simd4f simd_zwxy(simd4f v) { return vextq_f32(v, v, 2); }
+inline simd4f simd_yxwz(simd4f v) { return vrev64q_f32(v); }
+inline simd4f simd_wwww(simd4f v) { return vdupq_lane_f32(vget_high_f32(v), 1); }
+
+// Unsigned 32-bit lanes, for bit packing. Float conversions truncate and
+// expect values in [0, 2^31).
+typedef uint32x4_t simd4i;
+
+inline simd4i simd_loadi(const unsigned int* p) {
+    return vld1q_u32(reinterpret_cast<const uint32_t*>(p));
+}
+
+inline void simd_storei(unsigned int* p, simd4i v) {
+    vst1q_u32(reinterpret_cast<uint32_t*>(p), v);
+}
+
+inline simd4i simd_splati(unsigned int i) {
+    return vdupq_n_u32(i);
+}
+
+inline simd4i simd_ftoi(simd4f v) {
+    return vcvtq_u32_f32(v);
+}
+
+inline simd4f simd_itof(simd4i v) {
+    return vcvtq_f32_u32(v);
+}
+
+inline simd4i simd_andi(simd4i a, simd4i b) {
+    return vandq_u32(a, b);
+}
+
+inline simd4i simd_ori(simd4i a, simd4i b) {
+    return vorrq_u32(a, b);
+}
+
+template<int n>
+inline simd4i simd_shli(simd4i v) {
+    return vshlq_n_u32(v, n);
+}
+
+template<int n>
+inline simd4i simd_shri(simd4i v) {
+    return vshrq_n_u32(v, n);
+}
+#endif
+
+#if defined(ZMATH_SIMD)
+// In-place 4x4 transpose, e.g. between four quaternions and x/y/z/w registers
+inline void simd_transpose(simd4f& a, simd4f& b, simd4f& c, simd4f& d) {
+    auto t0 = simd_shuffle<0, 1, 0, 1>(a, b);
+    auto t1 = simd_shuffle<2, 3, 2, 3>(a, b);
+    auto t2 = simd_shuffle<0, 1, 0, 1>(c, d);
+    auto t3 = simd_shuffle<2, 3, 2, 3>(c, d);
+    a = simd_shuffle<0, 2, 0, 2>(t0, t2);
+    b = simd_shuffle<1, 3, 1, 3>(t0, t2);
+    c = simd_shuffle<0, 2, 0, 2>(t1, t3);
+    d = simd_shuffle<1, 3, 1, 3>(t1, t3);
+}
+
+// Four packed float triples (x, y, z) to and from x/y/z registers
+inline void simd_load3x4(const float* p, simd4f& x, simd4f& y, simd4f& z) {
+    auto v0 = simd_load(p);
+    auto v1 = simd_load(p + 4);
+    auto v2 = simd_load(p + 8);
+    x = simd_shuffle<0, 3, 0, 2>(v0, simd_shuffle<2, 2, 1, 1>(v1, v2));
+    y = simd_shuffle<0, 2, 0, 2>(simd_shuffle<1, 1, 0, 0>(v0, v1), simd_shuffle<3, 3, 2, 2>(v1, v2));
+    z = simd_shuffle<0, 2, 0, 2>(simd_shuffle<2, 2, 1, 1>(v0, v1), simd_shuffle<0, 0, 3, 3>(v2, v2));
+}
+
+inline void simd_store3x4(float* p, simd4f x, simd4f y, simd4f z) {
+    simd_store(p,     simd_shuffle<0, 2, 0, 2>(simd_shuffle<0, 0, 0, 0>(x, y), simd_shuffle<0, 0, 1, 1>(z, x)));
+    simd_store(p + 4, simd_shuffle<0, 2, 0, 2>(simd_shuffle<1, 1, 1, 1>(y, z), simd_shuffle<2, 2, 2, 2>(x, y)));
+    simd_store(p + 8, simd_shuffle<0, 2, 0, 2>(simd_shuffle<2, 2, 3, 3>(z, x), simd_shuffle<3, 3, 3, 3>(y, z)));
+}
+
+// 1 / length from squared lengths for the normalize_fast arrays; lengths at
+// or below epsilon give zero, as in normalize
+inline simd4f simd_normalize_scale(simd4f lengthSq) {
+    auto eps = std::numeric_limits<float>::epsilon();
+    return simd_select(simd_cmpgt(lengthSq, simd_splat(eps * eps)), simd_rsqrt(lengthSq), simd_zero());
+}
+
+template<>
+inline float rsqrt_fast(float x) {
+    return simd_get_x(simd_rsqrt(simd_splat(x)));
+}
+
+// Four lanes of sincos_fast. The multiple of pi/2 is rounded by the 1.5 * 2^23
+// trick and its quadrant bits are read from the unsigned conversion of
+// j + 2^22, which keeps |x| below about 6e6.
+inline void simd_sincos(simd4f x, simd4f& s, simd4f& c) {
+    auto magic = simd_splat(12582912.0f);
+    auto j = simd_sub(simd_add(simd_mul(x, simd_splat(float(2 / PI))), magic), magic);
+    auto r = simd_sub(x, simd_mul(j, simd_splat(1.5703125f)));
+    r = simd_sub(r, simd_mul(j, simd_splat(4.837512969970703125e-4f)));
+    r = simd_sub(r, simd_mul(j, simd_splat(7.54978995489188216e-8f)));
+
+    auto z = simd_mul(r, r);
+    auto ps = simd_madd(z, simd_splat(-1.9515295891e-4f), simd_splat(8.3321608736e-3f));
+    ps = simd_madd(z, ps, simd_splat(-1.6666654611e-1f));
+    ps = simd_madd(simd_mul(r, z), ps, r);
+    auto pc = simd_madd(z, simd_splat(2.443315711809948e-5f), simd_splat(-1.388731625493765e-3f));
+    pc = simd_madd(z, pc, simd_splat(4.166664568298827e-2f));
+    pc = simd_madd(simd_mul(z, z), pc, simd_sub(simd_splat(1.0f), simd_mul(z, simd_splat(0.5f))));
+
+    auto q = simd_ftoi(simd_add(j, simd_splat(4194304.0f)));
+    auto q1 = simd_ftoi(simd_add(j, simd_splat(4194305.0f)));
+    auto zero = simd_zero();
+    auto swap = simd_cmpgt(simd_itof(simd_andi(q, simd_splati(1))), zero);
+    auto negs = simd_cmpgt(simd_itof(simd_andi(q, simd_splati(2))), zero);
+    auto negc = simd_cmpgt(simd_itof(simd_andi(q1, simd_splati(2))), zero);
+
+    auto ss = simd_select(swap, pc, ps);
+    auto cc = simd_select(swap, ps, pc);
+    s = simd_select(negs, simd_sub(zero, ss), ss);
+    c = simd_select(negc, simd_sub(zero, cc), cc);
+}
+
+// Runs a four-wide kernel(out, in) over count elements. The tail is padded
+// with copies of the last input, so every element takes the same path.
+template<class Out, class In, class Kernel>
+void simd_for_blocks(Out* out, const In* in, size_t count, Kernel kernel) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        kernel(out + i * 4, in + i * 4);
+    }
+
+    auto rest = count - blocks * 4;
+    if (rest > 0) {
+        In a[4];
+        Out r[4];
+        for (size_t i = 0; i < 4; ++i) {
+            a[i] = in[blocks * 4 + ((i < rest) ? i : rest - 1)];
+        }
+        kernel(r, a);
+        for (size_t i = 0; i < rest; ++i) {
+            out[blocks * 4 + i] = r[i];
+        }
+    }
+}
+
+template<>
+inline void sincos_fast(float x, float& s, float& c) {
+    simd4f vs, vc;
+    simd_sincos(simd_splat(x), vs, vc);
+    s = simd_get_x(vs);
+    c = simd_get_x(vc);
+}
+
+template<>
+inline void sincos_fast(float* s, float* c, const float* x, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f vs, vc;
+        simd_sincos(simd_load(x + i * 4), vs, vc);
+        simd_store(s + i * 4, vs);
+        simd_store(c + i * 4, vc);
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        sincos_fast(x[i], s[i], c[i]);
+    }
+}
+#endif
+
+#if defined(ZMATH_FAST_TRIG)
+template<>
+inline void sincos(float x, float& s, float& c) {
+    sincos_fast(x, s, c);
+}
+#endif
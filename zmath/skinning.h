@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// Linear blend skinning with a mat4x3_t bone palette. Every vertex references
+// four bones (bones[i * 4 + k]) with weights (weights[i * 4 + k]) that sum to
+// one; unused slots have weight 0. Only vertices [begin, end) are processed,
+// so a mesh can be split into ranges and skinned on several threads at once.
+//
+// Positions and normals use byte strides like the array transforms; normals
+// may be null and are renormalized after blending. out may alias the input.
+
+template<class T>
+void skin_vertices(vec3_t<T>* outPositions, vec3_t<T>* outNormals, size_t outStride,
+                   const vec3_t<T>* positions, const vec3_t<T>* normals, size_t inStride,
+                   const unsigned char* bones, const T* weights, const mat4x3_t<T>* palette,
+                   size_t begin, size_t end) {
+    auto dst = reinterpret_cast<char*>(outPositions) + begin * outStride;
+    auto src = reinterpret_cast<const char*>(positions) + begin * inStride;
+    auto skinNormals = outNormals && normals;
+
+    for (auto i = begin; i < end; ++i, dst += outStride, src += inStride) {
+        auto b = bones + i * 4;
+        auto w = weights + i * 4;
+        auto m = palette[b[0]] * w[0] + palette[b[1]] * w[1] + palette[b[2]] * w[2] + palette[b[3]] * w[3];
+
+        auto p = *reinterpret_cast<const vec3_t<T>*>(src);
+        *reinterpret_cast<vec3_t<T>*>(dst) = vec3_t<T>(p.x * m.m11 + p.y * m.m21 + p.z * m.m31 + m.m41,
+                                                       p.x * m.m12 + p.y * m.m22 + p.z * m.m32 + m.m42,
+                                                       p.x * m.m13 + p.y * m.m23 + p.z * m.m33 + m.m43);
+
+        if (skinNormals) {
+            // Formed only with normals, offsetting a null pointer is undefined
+            auto srcNormal = reinterpret_cast<const char*>(normals) + i * inStride;
+            auto dstNormal = reinterpret_cast<char*>(outNormals) + i * outStride;
+            auto n = *reinterpret_cast<const vec3_t<T>*>(srcNormal);
+            *reinterpret_cast<vec3_t<T>*>(dstNormal) = normalize(vec3_t<T>(n.x * m.m11 + n.y * m.m21 + n.z * m.m31,
+                                                                           n.x * m.m12 + n.y * m.m22 + n.z * m.m32,
+                                                                           n.x * m.m13 + n.y * m.m23 + n.z * m.m33));
+        }
+    }
+}
+
+// Packed position and normal arrays
+template<class T>
+void skin_vertices(vec3_t<T>* outPositions, vec3_t<T>* outNormals,
+                   const vec3_t<T>* positions, const vec3_t<T>* normals,
+                   const unsigned char* bones, const T* weights, const mat4x3_t<T>* palette,
+                   size_t begin, size_t end) {
+    skin_vertices(outPositions, outNormals, sizeof(vec3_t<T>), positions, normals, sizeof(vec3_t<T>),
+                  bones, weights, palette, begin, end);
+}
+
+#if defined(ZMATH_SIMD)
+// The 12 floats of a mat4x3_t are blended as three registers, which are then
+// shuffled into the four rows once per vertex (lane 3 of every row is unused).
+template<>
+inline void skin_vertices(vec3_t<float>* outPositions, vec3_t<float>* outNormals, size_t outStride,
+                          const vec3_t<float>* positions, const vec3_t<float>* normals, size_t inStride,
+                          const unsigned char* bones, const float* weights, const mat4x3_t<float>* palette,
+                          size_t begin, size_t end) {
+    auto dst = reinterpret_cast<char*>(outPositions) + begin * outStride;
+    auto src = reinterpret_cast<const char*>(positions) + begin * inStride;
+    auto skinNormals = outNormals && normals;
+
+    for (auto i = begin; i < end; ++i, dst += outStride, src += inStride) {
+        auto b = bones + i * 4;
+        auto w = weights + i * 4;
+        auto a0 = simd_zero();
+        auto a1 = simd_zero();
+        auto a2 = simd_zero();
+
+        for (int k = 0; k < 4; ++k) {
+            auto m = &palette[b[k]].m11;
+            auto wk = simd_splat(w[k]);
+            a0 = simd_madd(simd_load(m), wk, a0);
+            a1 = simd_madd(simd_load(m + 4), wk, a1);
+            a2 = simd_madd(simd_load(m + 8), wk, a2);
+        }
+
+        // a0 = (m11 m12 m13 m21), a1 = (m22 m23 m31 m32), a2 = (m33 m41 m42 m43)
+        auto r1 = a0;
+        auto r2 = simd_shuffle<0, 2, 1, 1>(simd_shuffle<3, 3, 0, 0>(a0, a1), a1);
+        auto r3 = simd_shuffle<2, 3, 0, 0>(a1, a2);
+        auto r4 = simd_shuffle<1, 2, 3, 3>(a2, a2);
+
+        auto p = reinterpret_cast<const float*>(src);
+        auto v = simd_madd(simd_splat(p[0]), r1, r4);
+        v = simd_madd(simd_splat(p[1]), r2, v);
+        v = simd_madd(simd_splat(p[2]), r3, v);
+        simd_store3(reinterpret_cast<float*>(dst), v);
+
+        if (skinNormals) {
+            auto srcNormal = reinterpret_cast<const char*>(normals) + i * inStride;
+            auto dstNormal = reinterpret_cast<char*>(outNormals) + i * outStride;
+            auto n = reinterpret_cast<const float*>(srcNormal);
+            auto t = simd_mul(simd_splat(n[0]), r1);
+            t = simd_madd(simd_splat(n[1]), r2, t);
+            t = simd_madd(simd_splat(n[2]), r3, t);
+
+            auto out = reinterpret_cast<vec3_t<float>*>(dstNormal);
+            simd_store3(&out->x, t);
+            *out = normalize(*out);
+        }
+    }
+}
+#endif
@@ -0,0 +1,643 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+#include <vector>
+
+// Structure-of-arrays containers. Every component is stored in its own array so
+// that consecutive elements fill whole SIMD registers; the free functions below
+// mirror the vec3_t/vec4_t/quat_t ones and work on all elements at once.
+
+template<class T>
+struct vec3_soa_t {
+    std::vector<T> x, y, z;
+
+    vec3_soa_t() {}
+    explicit vec3_soa_t(size_t size) : x(size), y(size), z(size) {}
+
+    size_t size() const {
+        return x.size();
+    }
+
+    void resize(size_t size) {
+        x.resize(size);
+        y.resize(size);
+        z.resize(size);
+    }
+
+    vec3_t<T> get(size_t index) const {
+        assert(index < size());
+        return vec3_t<T>(x[index], y[index], z[index]);
+    }
+
+    void set(size_t index, const vec3_t<T>& v) {
+        assert(index < size());
+        x[index] = v.x;
+        y[index] = v.y;
+        z[index] = v.z;
+    }
+};
+
+template<class T>
+struct vec4_soa_t {
+    std::vector<T> x, y, z, w;
+
+    vec4_soa_t() {}
+    explicit vec4_soa_t(size_t size) : x(size), y(size), z(size), w(size) {}
+
+    size_t size() const {
+        return x.size();
+    }
+
+    void resize(size_t size) {
+        x.resize(size);
+        y.resize(size);
+        z.resize(size);
+        w.resize(size);
+    }
+
+    vec4_t<T> get(size_t index) const {
+        assert(index < size());
+        return vec4_t<T>(x[index], y[index], z[index], w[index]);
+    }
+
+    void set(size_t index, const vec4_t<T>& v) {
+        assert(index < size());
+        x[index] = v.x;
+        y[index] = v.y;
+        z[index] = v.z;
+        w[index] = v.w;
+    }
+};
+
+template<class T>
+struct quat_soa_t {
+    std::vector<T> x, y, z, w;
+
+    quat_soa_t() {}
+    explicit quat_soa_t(size_t size) : x(size), y(size), z(size), w(size, T(1)) {}
+
+    size_t size() const {
+        return x.size();
+    }
+
+    void resize(size_t size) {
+        x.resize(size);
+        y.resize(size);
+        z.resize(size);
+        w.resize(size, T(1));
+    }
+
+    quat_t<T> get(size_t index) const {
+        assert(index < size());
+        return quat_t<T>(x[index], y[index], z[index], w[index]);
+    }
+
+    void set(size_t index, const quat_t<T>& q) {
+        assert(index < size());
+        x[index] = q.x;
+        y[index] = q.y;
+        z[index] = q.z;
+        w[index] = q.w;
+    }
+};
+
+// AoS <-> SoA conversion
+template<class T>
+void to_soa(const vec3_t<T>* v, size_t count, vec3_soa_t<T>& out) {
+    out.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        out.x[i] = v[i].x;
+        out.y[i] = v[i].y;
+        out.z[i] = v[i].z;
+    }
+}
+
+template<class T>
+void to_soa(const vec4_t<T>* v, size_t count, vec4_soa_t<T>& out) {
+    out.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        out.x[i] = v[i].x;
+        out.y[i] = v[i].y;
+        out.z[i] = v[i].z;
+        out.w[i] = v[i].w;
+    }
+}
+
+template<class T>
+void to_soa(const quat_t<T>* q, size_t count, quat_soa_t<T>& out) {
+    out.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        out.x[i] = q[i].x;
+        out.y[i] = q[i].y;
+        out.z[i] = q[i].z;
+        out.w[i] = q[i].w;
+    }
+}
+
+template<class T>
+void to_aos(const vec3_soa_t<T>& v, vec3_t<T>* out) {
+    for (size_t i = 0; i < v.size(); ++i) {
+        out[i] = vec3_t<T>(v.x[i], v.y[i], v.z[i]);
+    }
+}
+
+template<class T>
+void to_aos(const vec4_soa_t<T>& v, vec4_t<T>* out) {
+    for (size_t i = 0; i < v.size(); ++i) {
+        out[i] = vec4_t<T>(v.x[i], v.y[i], v.z[i], v.w[i]);
+    }
+}
+
+template<class T>
+void to_aos(const quat_soa_t<T>& q, quat_t<T>* out) {
+    for (size_t i = 0; i < q.size(); ++i) {
+        out[i] = quat_t<T>(q.x[i], q.y[i], q.z[i], q.w[i]);
+    }
+}
+
+// vec3_soa_t
+template<class T>
+void dot(const vec3_soa_t<T>& v1, const vec3_soa_t<T>& v2, T* out) {
+    assert(v1.size() == v2.size());
+
+    for (size_t i = 0; i < v1.size(); ++i) {
+        out[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i];
+    }
+}
+
+template<class T>
+void cross(const vec3_soa_t<T>& v1, const vec3_soa_t<T>& v2, vec3_soa_t<T>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+
+    for (size_t i = 0; i < v1.size(); ++i) {
+        auto x = v1.y[i] * v2.z[i] - v1.z[i] * v2.y[i];
+        auto y = v1.z[i] * v2.x[i] - v1.x[i] * v2.z[i];
+        auto z = v1.x[i] * v2.y[i] - v1.y[i] * v2.x[i];
+        out.x[i] = x;
+        out.y[i] = y;
+        out.z[i] = z;
+    }
+}
+
+template<class T>
+void normalize(const vec3_soa_t<T>& v, vec3_soa_t<T>& out) {
+    out.resize(v.size());
+
+    for (size_t i = 0; i < v.size(); ++i) {
+        auto m = sqrt(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i]);
+        m = (m > std::numeric_limits<T>::epsilon()) ? 1 / m : 0;
+        out.x[i] = v.x[i] * m;
+        out.y[i] = v.y[i] * m;
+        out.z[i] = v.z[i] * m;
+    }
+}
+
+template<class T>
+void lerp(const vec3_soa_t<T>& min, const vec3_soa_t<T>& max, T scale, vec3_soa_t<T>& out) {
+    assert(min.size() == max.size());
+    out.resize(min.size());
+
+    for (size_t i = 0; i < min.size(); ++i) {
+        out.x[i] = min.x[i] + scale * (max.x[i] - min.x[i]);
+        out.y[i] = min.y[i] + scale * (max.y[i] - min.y[i]);
+        out.z[i] = min.z[i] + scale * (max.z[i] - min.z[i]);
+    }
+}
+
+template<class T>
+void minimize(const vec3_soa_t<T>& v1, const vec3_soa_t<T>& v2, vec3_soa_t<T>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+
+    for (size_t i = 0; i < v1.size(); ++i) {
+        out.x[i] = (v1.x[i] < v2.x[i]) ? v1.x[i] : v2.x[i];
+        out.y[i] = (v1.y[i] < v2.y[i]) ? v1.y[i] : v2.y[i];
+        out.z[i] = (v1.z[i] < v2.z[i]) ? v1.z[i] : v2.z[i];
+    }
+}
+
+template<class T>
+void maximize(const vec3_soa_t<T>& v1, const vec3_soa_t<T>& v2, vec3_soa_t<T>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+
+    for (size_t i = 0; i < v1.size(); ++i) {
+        out.x[i] = (v1.x[i] > v2.x[i]) ? v1.x[i] : v2.x[i];
+        out.y[i] = (v1.y[i] > v2.y[i]) ? v1.y[i] : v2.y[i];
+        out.z[i] = (v1.z[i] > v2.z[i]) ? v1.z[i] : v2.z[i];
+    }
+}
+
+// vec4_soa_t
+template<class T>
+void dot(const vec4_soa_t<T>& v1, const vec4_soa_t<T>& v2, T* out) {
+    assert(v1.size() == v2.size());
+
+    for (size_t i = 0; i < v1.size(); ++i) {
+        out[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i] + v1.w[i] * v2.w[i];
+    }
+}
+
+template<class T>
+void normalize(const vec4_soa_t<T>& v, vec4_soa_t<T>& out) {
+    out.resize(v.size());
+
+    for (size_t i = 0; i < v.size(); ++i) {
+        auto m = sqrt(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i] + v.w[i] * v.w[i]);
+        m = (m > std::numeric_limits<T>::epsilon()) ? 1 / m : 0;
+        out.x[i] = v.x[i] * m;
+        out.y[i] = v.y[i] * m;
+        out.z[i] = v.z[i] * m;
+        out.w[i] = v.w[i] * m;
+    }
+}
+
+template<class T>
+void lerp(const vec4_soa_t<T>& min, const vec4_soa_t<T>& max, T scale, vec4_soa_t<T>& out) {
+    assert(min.size() == max.size());
+    out.resize(min.size());
+
+    for (size_t i = 0; i < min.size(); ++i) {
+        out.x[i] = min.x[i] + scale * (max.x[i] - min.x[i]);
+        out.y[i] = min.y[i] + scale * (max.y[i] - min.y[i]);
+        out.z[i] = min.z[i] + scale * (max.z[i] - min.z[i]);
+        out.w[i] = min.w[i] + scale * (max.w[i] - min.w[i]);
+    }
+}
+
+template<class T>
+void minimize(const vec4_soa_t<T>& v1, const vec4_soa_t<T>& v2, vec4_soa_t<T>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+
+    for (size_t i = 0; i < v1.size(); ++i) {
+        out.x[i] = (v1.x[i] < v2.x[i]) ? v1.x[i] : v2.x[i];
+        out.y[i] = (v1.y[i] < v2.y[i]) ? v1.y[i] : v2.y[i];
+        out.z[i] = (v1.z[i] < v2.z[i]) ? v1.z[i] : v2.z[i];
+        out.w[i] = (v1.w[i] < v2.w[i]) ? v1.w[i] : v2.w[i];
+    }
+}
+
+template<class T>
+void maximize(const vec4_soa_t<T>& v1, const vec4_soa_t<T>& v2, vec4_soa_t<T>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+
+    for (size_t i = 0; i < v1.size(); ++i) {
+        out.x[i] = (v1.x[i] > v2.x[i]) ? v1.x[i] : v2.x[i];
+        out.y[i] = (v1.y[i] > v2.y[i]) ? v1.y[i] : v2.y[i];
+        out.z[i] = (v1.z[i] > v2.z[i]) ? v1.z[i] : v2.z[i];
+        out.w[i] = (v1.w[i] > v2.w[i]) ? v1.w[i] : v2.w[i];
+    }
+}
+
+// quat_soa_t
+template<class T>
+void dot(const quat_soa_t<T>& q1, const quat_soa_t<T>& q2, T* out) {
+    assert(q1.size() == q2.size());
+
+    for (size_t i = 0; i < q1.size(); ++i) {
+        out[i] = q1.x[i] * q2.x[i] + q1.y[i] * q2.y[i] + q1.z[i] * q2.z[i] + q1.w[i] * q2.w[i];
+    }
+}
+
+template<class T>
+void normalize(const quat_soa_t<T>& q, quat_soa_t<T>& out) {
+    out.resize(q.size());
+
+    for (size_t i = 0; i < q.size(); ++i) {
+        auto m = sqrt(q.x[i] * q.x[i] + q.y[i] * q.y[i] + q.z[i] * q.z[i] + q.w[i] * q.w[i]);
+        m = (m > std::numeric_limits<T>::epsilon()) ? 1 / m : 0;
+        out.x[i] = q.x[i] * m;
+        out.y[i] = q.y[i] * m;
+        out.z[i] = q.z[i] * m;
+        out.w[i] = q.w[i] * m;
+    }
+}
+
+// Exact slerp; it needs acos and sin per element, so it stays scalar. See
+// slerp_fast for the version that runs on SIMD.
+template<class T>
+void slerp(const quat_soa_t<T>& from, const quat_soa_t<T>& to, T scale, quat_soa_t<T>& out) {
+    assert(from.size() == to.size());
+    out.resize(from.size());
+
+    for (size_t i = 0; i < from.size(); ++i) {
+        out.set(i, quat_t<T>::slerp(from.get(i), to.get(i), scale));
+    }
+}
+
+// quat_t::slerp_fast on every element
+template<class T>
+void slerp_fast(const quat_soa_t<T>& from, const quat_soa_t<T>& to, T scale, quat_soa_t<T>& out) {
+    assert(from.size() == to.size());
+    out.resize(from.size());
+
+    for (size_t i = 0; i < from.size(); ++i) {
+        out.set(i, quat_t<T>::slerp_fast(from.get(i), to.get(i), scale));
+    }
+}
+
+#if defined(ZMATH_SIMD)
+// Float specializations run four elements per iteration and finish the
+// remainder with the generic code.
+template<>
+inline void dot(const vec3_soa_t<float>& v1, const vec3_soa_t<float>& v2, float* out) {
+    assert(v1.size() == v2.size());
+    size_t i = 0;
+
+    for (; i + 4 <= v1.size(); i += 4) {
+        auto d = simd_mul(simd_load(&v1.x[i]), simd_load(&v2.x[i]));
+        d = simd_madd(simd_load(&v1.y[i]), simd_load(&v2.y[i]), d);
+        d = simd_madd(simd_load(&v1.z[i]), simd_load(&v2.z[i]), d);
+        simd_store(&out[i], d);
+    }
+
+    for (; i < v1.size(); ++i) {
+        out[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i];
+    }
+}
+
+template<>
+inline void cross(const vec3_soa_t<float>& v1, const vec3_soa_t<float>& v2, vec3_soa_t<float>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+    size_t i = 0;
+
+    for (; i + 4 <= v1.size(); i += 4) {
+        auto x1 = simd_load(&v1.x[i]), y1 = simd_load(&v1.y[i]), z1 = simd_load(&v1.z[i]);
+        auto x2 = simd_load(&v2.x[i]), y2 = simd_load(&v2.y[i]), z2 = simd_load(&v2.z[i]);
+        simd_store(&out.x[i], simd_sub(simd_mul(y1, z2), simd_mul(z1, y2)));
+        simd_store(&out.y[i], simd_sub(simd_mul(z1, x2), simd_mul(x1, z2)));
+        simd_store(&out.z[i], simd_sub(simd_mul(x1, y2), simd_mul(y1, x2)));
+    }
+
+    for (; i < v1.size(); ++i) {
+        out.set(i, cross(v1.get(i), v2.get(i)));
+    }
+}
+
+template<>
+inline void normalize(const vec3_soa_t<float>& v, vec3_soa_t<float>& out) {
+    out.resize(v.size());
+    auto eps = simd_splat(std::numeric_limits<float>::epsilon());
+    auto one = simd_splat(1);
+    size_t i = 0;
+
+    for (; i + 4 <= v.size(); i += 4) {
+        auto x = simd_load(&v.x[i]), y = simd_load(&v.y[i]), z = simd_load(&v.z[i]);
+        auto m = simd_sqrt(simd_madd(z, z, simd_madd(y, y, simd_mul(x, x))));
+        m = simd_select(simd_cmpgt(m, eps), simd_div(one, m), simd_zero());
+        simd_store(&out.x[i], simd_mul(x, m));
+        simd_store(&out.y[i], simd_mul(y, m));
+        simd_store(&out.z[i], simd_mul(z, m));
+    }
+
+    for (; i < v.size(); ++i) {
+        out.set(i, normalize(v.get(i)));
+    }
+}
+
+template<>
+inline void lerp(const vec3_soa_t<float>& min, const vec3_soa_t<float>& max, float scale, vec3_soa_t<float>& out) {
+    assert(min.size() == max.size());
+    out.resize(min.size());
+    auto s = simd_splat(scale);
+    size_t i = 0;
+
+    for (; i + 4 <= min.size(); i += 4) {
+        auto x = simd_load(&min.x[i]), y = simd_load(&min.y[i]), z = simd_load(&min.z[i]);
+        simd_store(&out.x[i], simd_madd(s, simd_sub(simd_load(&max.x[i]), x), x));
+        simd_store(&out.y[i], simd_madd(s, simd_sub(simd_load(&max.y[i]), y), y));
+        simd_store(&out.z[i], simd_madd(s, simd_sub(simd_load(&max.z[i]), z), z));
+    }
+
+    for (; i < min.size(); ++i) {
+        out.set(i, lerp(min.get(i), max.get(i), scale));
+    }
+}
+
+template<>
+inline void minimize(const vec3_soa_t<float>& v1, const vec3_soa_t<float>& v2, vec3_soa_t<float>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+    size_t i = 0;
+
+    for (; i + 4 <= v1.size(); i += 4) {
+        simd_store(&out.x[i], simd_min(simd_load(&v1.x[i]), simd_load(&v2.x[i])));
+        simd_store(&out.y[i], simd_min(simd_load(&v1.y[i]), simd_load(&v2.y[i])));
+        simd_store(&out.z[i], simd_min(simd_load(&v1.z[i]), simd_load(&v2.z[i])));
+    }
+
+    for (; i < v1.size(); ++i) {
+        out.set(i, minimize(v1.get(i), v2.get(i)));
+    }
+}
+
+template<>
+inline void maximize(const vec3_soa_t<float>& v1, const vec3_soa_t<float>& v2, vec3_soa_t<float>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+    size_t i = 0;
+
+    for (; i + 4 <= v1.size(); i += 4) {
+        simd_store(&out.x[i], simd_max(simd_load(&v1.x[i]), simd_load(&v2.x[i])));
+        simd_store(&out.y[i], simd_max(simd_load(&v1.y[i]), simd_load(&v2.y[i])));
+        simd_store(&out.z[i], simd_max(simd_load(&v1.z[i]), simd_load(&v2.z[i])));
+    }
+
+    for (; i < v1.size(); ++i) {
+        out.set(i, maximize(v1.get(i), v2.get(i)));
+    }
+}
+
+template<>
+inline void dot(const vec4_soa_t<float>& v1, const vec4_soa_t<float>& v2, float* out) {
+    assert(v1.size() == v2.size());
+    size_t i = 0;
+
+    for (; i + 4 <= v1.size(); i += 4) {
+        auto d = simd_mul(simd_load(&v1.x[i]), simd_load(&v2.x[i]));
+        d = simd_madd(simd_load(&v1.y[i]), simd_load(&v2.y[i]), d);
+        d = simd_madd(simd_load(&v1.z[i]), simd_load(&v2.z[i]), d);
+        d = simd_madd(simd_load(&v1.w[i]), simd_load(&v2.w[i]), d);
+        simd_store(&out[i], d);
+    }
+
+    for (; i < v1.size(); ++i) {
+        out[i] = v1.x[i] * v2.x[i] + v1.y[i] * v2.y[i] + v1.z[i] * v2.z[i] + v1.w[i] * v2.w[i];
+    }
+}
+
+template<>
+inline void normalize(const vec4_soa_t<float>& v, vec4_soa_t<float>& out) {
+    out.resize(v.size());
+    auto eps = simd_splat(std::numeric_limits<float>::epsilon());
+    auto one = simd_splat(1);
+    size_t i = 0;
+
+    for (; i + 4 <= v.size(); i += 4) {
+        auto x = simd_load(&v.x[i]), y = simd_load(&v.y[i]), z = simd_load(&v.z[i]), w = simd_load(&v.w[i]);
+        auto m = simd_sqrt(simd_madd(w, w, simd_madd(z, z, simd_madd(y, y, simd_mul(x, x)))));
+        m = simd_select(simd_cmpgt(m, eps), simd_div(one, m), simd_zero());
+        simd_store(&out.x[i], simd_mul(x, m));
+        simd_store(&out.y[i], simd_mul(y, m));
+        simd_store(&out.z[i], simd_mul(z, m));
+        simd_store(&out.w[i], simd_mul(w, m));
+    }
+
+    for (; i < v.size(); ++i) {
+        out.set(i, normalize(v.get(i)));
+    }
+}
+
+template<>
+inline void lerp(const vec4_soa_t<float>& min, const vec4_soa_t<float>& max, float scale, vec4_soa_t<float>& out) {
+    assert(min.size() == max.size());
+    out.resize(min.size());
+    auto s = simd_splat(scale);
+    size_t i = 0;
+
+    for (; i + 4 <= min.size(); i += 4) {
+        auto x = simd_load(&min.x[i]), y = simd_load(&min.y[i]), z = simd_load(&min.z[i]), w = simd_load(&min.w[i]);
+        simd_store(&out.x[i], simd_madd(s, simd_sub(simd_load(&max.x[i]), x), x));
+        simd_store(&out.y[i], simd_madd(s, simd_sub(simd_load(&max.y[i]), y), y));
+        simd_store(&out.z[i], simd_madd(s, simd_sub(simd_load(&max.z[i]), z), z));
+        simd_store(&out.w[i], simd_madd(s, simd_sub(simd_load(&max.w[i]), w), w));
+    }
+
+    for (; i < min.size(); ++i) {
+        out.set(i, lerp(min.get(i), max.get(i), scale));
+    }
+}
+
+template<>
+inline void minimize(const vec4_soa_t<float>& v1, const vec4_soa_t<float>& v2, vec4_soa_t<float>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+    size_t i = 0;
+
+    for (; i + 4 <= v1.size(); i += 4) {
+        simd_store(&out.x[i], simd_min(simd_load(&v1.x[i]), simd_load(&v2.x[i])));
+        simd_store(&out.y[i], simd_min(simd_load(&v1.y[i]), simd_load(&v2.y[i])));
+        simd_store(&out.z[i], simd_min(simd_load(&v1.z[i]), simd_load(&v2.z[i])));
+        simd_store(&out.w[i], simd_min(simd_load(&v1.w[i]), simd_load(&v2.w[i])));
+    }
+
+    for (; i < v1.size(); ++i) {
+        out.set(i, minimize(v1.get(i), v2.get(i)));
+    }
+}
+
+template<>
+inline void maximize(const vec4_soa_t<float>& v1, const vec4_soa_t<float>& v2, vec4_soa_t<float>& out) {
+    assert(v1.size() == v2.size());
+    out.resize(v1.size());
+    size_t i = 0;
+
+    for (; i + 4 <= v1.size(); i += 4) {
+        simd_store(&out.x[i], simd_max(simd_load(&v1.x[i]), simd_load(&v2.x[i])));
+        simd_store(&out.y[i], simd_max(simd_load(&v1.y[i]), simd_load(&v2.y[i])));
+        simd_store(&out.z[i], simd_max(simd_load(&v1.z[i]), simd_load(&v2.z[i])));
+        simd_store(&out.w[i], simd_max(simd_load(&v1.w[i]), simd_load(&v2.w[i])));
+    }
+
+    for (; i < v1.size(); ++i) {
+        out.set(i, maximize(v1.get(i), v2.get(i)));
+    }
+}
+
+template<>
+inline void dot(const quat_soa_t<float>& q1, const quat_soa_t<float>& q2, float* out) {
+    assert(q1.size() == q2.size());
+    size_t i = 0;
+
+    for (; i + 4 <= q1.size(); i += 4) {
+        auto d = simd_mul(simd_load(&q1.x[i]), simd_load(&q2.x[i]));
+        d = simd_madd(simd_load(&q1.y[i]), simd_load(&q2.y[i]), d);
+        d = simd_madd(simd_load(&q1.z[i]), simd_load(&q2.z[i]), d);
+        d = simd_madd(simd_load(&q1.w[i]), simd_load(&q2.w[i]), d);
+        simd_store(&out[i], d);
+    }
+
+    for (; i < q1.size(); ++i) {
+        out[i] = q1.x[i] * q2.x[i] + q1.y[i] * q2.y[i] + q1.z[i] * q2.z[i] + q1.w[i] * q2.w[i];
+    }
+}
+
+template<>
+inline void normalize(const quat_soa_t<float>& q, quat_soa_t<float>& out) {
+    out.resize(q.size());
+    auto eps = simd_splat(std::numeric_limits<float>::epsilon());
+    auto one = simd_splat(1);
+    size_t i = 0;
+
+    for (; i + 4 <= q.size(); i += 4) {
+        auto x = simd_load(&q.x[i]), y = simd_load(&q.y[i]), z = simd_load(&q.z[i]), w = simd_load(&q.w[i]);
+        auto m = simd_sqrt(simd_madd(w, w, simd_madd(z, z, simd_madd(y, y, simd_mul(x, x)))));
+        m = simd_select(simd_cmpgt(m, eps), simd_div(one, m), simd_zero());
+        simd_store(&out.x[i], simd_mul(x, m));
+        simd_store(&out.y[i], simd_mul(y, m));
+        simd_store(&out.z[i], simd_mul(z, m));
+        simd_store(&out.w[i], simd_mul(w, m));
+    }
+
+    for (; i < q.size(); ++i) {
+        out.set(i, normalize(q.get(i)));
+    }
+}
+
+template<>
+inline void slerp_fast(const quat_soa_t<float>& from, const quat_soa_t<float>& to, float scale, quat_soa_t<float>& out) {
+    assert(from.size() == to.size());
+    out.resize(from.size());
+    auto t0 = simd_splat(1 - scale);
+    auto t1 = simd_splat(scale);
+    auto one = simd_splat(1.0f);
+    size_t i = 0;
+
+    for (; i + 4 <= from.size(); i += 4) {
+        auto x0 = simd_load(&from.x[i]), y0 = simd_load(&from.y[i]), z0 = simd_load(&from.z[i]), w0 = simd_load(&from.w[i]);
+        auto x1 = simd_load(&to.x[i]), y1 = simd_load(&to.y[i]), z1 = simd_load(&to.z[i]), w1 = simd_load(&to.w[i]);
+        auto c = simd_madd(w0, w1, simd_madd(z0, z1, simd_madd(y0, y1, simd_mul(x0, x1))));
+
+        // Shorter arc: negate the second weight where the dot product is negative
+        auto sign = simd_select(simd_cmplt(c, simd_zero()), simd_sub(simd_zero(), one), one);
+        c = simd_abs(c);
+        auto s0 = quat_slerp_weight(t0, c);
+        auto s1 = simd_mul(quat_slerp_weight(t1, c), sign);
+        simd_store(&out.x[i], simd_madd(x0, s0, simd_mul(x1, s1)));
+        simd_store(&out.y[i], simd_madd(y0, s0, simd_mul(y1, s1)));
+        simd_store(&out.z[i], simd_madd(z0, s0, simd_mul(z1, s1)));
+        simd_store(&out.w[i], simd_madd(w0, s0, simd_mul(w1, s1)));
+    }
+
+    for (; i < from.size(); ++i) {
+        out.set(i, quat_t<float>::slerp_fast(from.get(i), to.get(i), scale));
+    }
+}
+#endif
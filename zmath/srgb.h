@@ -0,0 +1,305 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// sRGB transfer function (IEC 61966-2-1). The exact conversions call pow.
+// The fast ones clamp to [0, 1] and use rational approximations: decoding
+// has a relative error below 2e-6, encoding an absolute error below 3e-6,
+// so 8-bit encoding only differs from the exact rounding on ties (about
+// 1 in 6000 inputs, by one code). 8-bit input is decoded through a
+// 256-entry table.
+
+template<class T>
+T srgb_to_linear(T c) {
+    return (c <= T(0.04045)) ? c / T(12.92) : pow((c + T(0.055)) / T(1.055), T(2.4));
+}
+
+template<class T>
+T linear_to_srgb(T c) {
+    return (c <= T(0.0031308)) ? c * T(12.92) : T(1.055) * pow(c, T(1) / T(2.4)) - T(0.055);
+}
+
+template<class T>
+T srgb_to_linear_fast(T c) {
+    c = saturate(c);
+
+    if (c <= T(0.04045)) {
+        return c / T(12.92);
+    }
+
+    auto p = (((T(3.8636956573957226) * c + T(3.3251102480619465)) * c + T(0.6366748150085381)) * c +
+              T(0.04019322256928604)) * c + T(0.0008347299891032457);
+    auto q = (((T(0.043626568149290994) * c - T(0.31947253995795283)) * c + T(2.489915875037861)) * c +
+              T(4.652433827150846)) * c + 1;
+    return p / q;
+}
+
+// The approximation is in sqrt(c), which absorbs the steep start of c^(1/2.4)
+template<class T>
+T linear_to_srgb_fast(T c) {
+    c = saturate(c);
+
+    if (c <= T(0.0031308)) {
+        return c * T(12.92);
+    }
+
+    auto s = sqrt(c);
+    auto p = (((T(74.76065248342564) * s + T(148.23178043720372)) * s + T(38.942649068588786)) * s +
+              T(0.5228544223764776)) * s - T(0.05112359462907296);
+    auto q = (((T(2.4950242676273406) * s + T(93.9507074625197)) * s + T(134.6593601982887)) * s +
+              T(30.302165096977117)) * s + 1;
+    return p / q;
+}
+
+// Alpha is linear and passed through unchanged
+template<class T>
+color3_t<T> srgb_to_linear(const color3_t<T>& c) {
+    return color3_t<T>(srgb_to_linear(c.r), srgb_to_linear(c.g), srgb_to_linear(c.b));
+}
+
+template<class T>
+color4_t<T> srgb_to_linear(const color4_t<T>& c) {
+    return color4_t<T>(srgb_to_linear(c.r), srgb_to_linear(c.g), srgb_to_linear(c.b), c.a);
+}
+
+template<class T>
+color3_t<T> linear_to_srgb(const color3_t<T>& c) {
+    return color3_t<T>(linear_to_srgb(c.r), linear_to_srgb(c.g), linear_to_srgb(c.b));
+}
+
+template<class T>
+color4_t<T> linear_to_srgb(const color4_t<T>& c) {
+    return color4_t<T>(linear_to_srgb(c.r), linear_to_srgb(c.g), linear_to_srgb(c.b), c.a);
+}
+
+// Decoded values of all 8-bit sRGB codes, built on first use
+template<class T>
+const T* srgb8_table() {
+    static const struct table_t {
+        T values[256];
+
+        table_t() {
+            for (int i = 0; i < 256; ++i) {
+                values[i] = srgb_to_linear(T(i) / 255);
+            }
+        }
+    } table;
+
+    return table.values;
+}
+
+template<class T>
+T srgb8_to_linear(unsigned char c) {
+    return srgb8_table<T>()[c];
+}
+
+template<class T>
+unsigned char linear_to_srgb8(T c) {
+    return (unsigned char)(linear_to_srgb_fast(c) * 255 + T(0.5));
+}
+
+// Array versions for image rows; out may alias in for the float variants.
+template<class T>
+void srgb_to_linear_fast(T* out, const T* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = srgb_to_linear_fast(in[i]);
+    }
+}
+
+template<class T>
+void linear_to_srgb_fast(T* out, const T* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = linear_to_srgb_fast(in[i]);
+    }
+}
+
+template<class T>
+void srgb_to_linear_fast(color3_t<T>* out, const color3_t<T>* in, size_t count) {
+    srgb_to_linear_fast(&out->r, &in->r, count * 3);
+}
+
+template<class T>
+void linear_to_srgb_fast(color3_t<T>* out, const color3_t<T>* in, size_t count) {
+    linear_to_srgb_fast(&out->r, &in->r, count * 3);
+}
+
+template<class T>
+void srgb_to_linear_fast(color4_t<T>* out, const color4_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = color4_t<T>(srgb_to_linear_fast(in[i].r), srgb_to_linear_fast(in[i].g),
+                             srgb_to_linear_fast(in[i].b), in[i].a);
+    }
+}
+
+template<class T>
+void linear_to_srgb_fast(color4_t<T>* out, const color4_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = color4_t<T>(linear_to_srgb_fast(in[i].r), linear_to_srgb_fast(in[i].g),
+                             linear_to_srgb_fast(in[i].b), in[i].a);
+    }
+}
+
+// count bytes, e.g. three per pixel of an RGB8 row
+template<class T>
+void srgb8_to_linear(T* out, const unsigned char* in, size_t count) {
+    auto table = srgb8_table<T>();
+
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = table[in[i]];
+    }
+}
+
+template<class T>
+void linear_to_srgb8(unsigned char* out, const T* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = linear_to_srgb8(in[i]);
+    }
+}
+
+// RGBA8 rows with linear 8-bit alpha
+template<class T>
+void srgba8_to_linear(color4_t<T>* out, const unsigned char* in, size_t count) {
+    auto table = srgb8_table<T>();
+
+    for (size_t i = 0; i < count; ++i, in += 4) {
+        out[i] = color4_t<T>(table[in[0]], table[in[1]], table[in[2]], T(in[3]) / 255);
+    }
+}
+
+template<class T>
+void linear_to_srgba8(unsigned char* out, const color4_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i, out += 4) {
+        out[0] = linear_to_srgb8(in[i].r);
+        out[1] = linear_to_srgb8(in[i].g);
+        out[2] = linear_to_srgb8(in[i].b);
+        out[3] = (unsigned char)(saturate(in[i].a) * 255 + T(0.5));
+    }
+}
+
+#if defined(ZMATH_SIMD)
+inline simd4f srgb_to_linear_fast(simd4f c) {
+    c = simd_min(simd_max(c, simd_zero()), simd_splat(1.0f));
+    auto p = simd_madd(simd_splat(3.8636956573957226f), c, simd_splat(3.3251102480619465f));
+    p = simd_madd(p, c, simd_splat(0.6366748150085381f));
+    p = simd_madd(p, c, simd_splat(0.04019322256928604f));
+    p = simd_madd(p, c, simd_splat(0.0008347299891032457f));
+    auto q = simd_madd(simd_splat(0.043626568149290994f), c, simd_splat(-0.31947253995795283f));
+    q = simd_madd(q, c, simd_splat(2.489915875037861f));
+    q = simd_madd(q, c, simd_splat(4.652433827150846f));
+    q = simd_madd(q, c, simd_splat(1.0f));
+    return simd_select(simd_cmple(c, simd_splat(0.04045f)), simd_div(c, simd_splat(12.92f)), simd_div(p, q));
+}
+
+inline simd4f linear_to_srgb_fast(simd4f c) {
+    c = simd_min(simd_max(c, simd_zero()), simd_splat(1.0f));
+    auto s = simd_sqrt(c);
+    auto p = simd_madd(simd_splat(74.76065248342564f), s, simd_splat(148.23178043720372f));
+    p = simd_madd(p, s, simd_splat(38.942649068588786f));
+    p = simd_madd(p, s, simd_splat(0.5228544223764776f));
+    p = simd_madd(p, s, simd_splat(-0.05112359462907296f));
+    auto q = simd_madd(simd_splat(2.4950242676273406f), s, simd_splat(93.9507074625197f));
+    q = simd_madd(q, s, simd_splat(134.6593601982887f));
+    q = simd_madd(q, s, simd_splat(30.302165096977117f));
+    q = simd_madd(q, s, simd_splat(1.0f));
+    return simd_select(simd_cmple(c, simd_splat(0.0031308f)), simd_mul(c, simd_splat(12.92f)), simd_div(p, q));
+}
+
+// Rounds and packs four encoded channels into bytes
+inline void srgb_store8(unsigned char* out, simd4f c) {
+    unsigned int bits[4];
+    simd_storei(bits, simd_ftoi(simd_madd(c, simd_splat(255.0f), simd_splat(0.5f))));
+    out[0] = (unsigned char)bits[0];
+    out[1] = (unsigned char)bits[1];
+    out[2] = (unsigned char)bits[2];
+    out[3] = (unsigned char)bits[3];
+}
+
+template<>
+inline void srgb_to_linear_fast(float* out, const float* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd_store(out + i * 4, srgb_to_linear_fast(simd_load(in + i * 4)));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = srgb_to_linear_fast(in[i]);
+    }
+}
+
+template<>
+inline void linear_to_srgb_fast(float* out, const float* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd_store(out + i * 4, linear_to_srgb_fast(simd_load(in + i * 4)));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = linear_to_srgb_fast(in[i]);
+    }
+}
+
+template<>
+inline void srgb_to_linear_fast(color4_t<float>* out, const color4_t<float>* in, size_t count) {
+    auto rgb = simd_cmplt(simd_set(0, 0, 0, 1), simd_splat(0.5f));
+
+    for (size_t i = 0; i < count; ++i) {
+        auto c = simd_load(&in[i].r);
+        simd_store(&out[i].r, simd_select(rgb, srgb_to_linear_fast(c), c));
+    }
+}
+
+template<>
+inline void linear_to_srgb_fast(color4_t<float>* out, const color4_t<float>* in, size_t count) {
+    auto rgb = simd_cmplt(simd_set(0, 0, 0, 1), simd_splat(0.5f));
+
+    for (size_t i = 0; i < count; ++i) {
+        auto c = simd_load(&in[i].r);
+        simd_store(&out[i].r, simd_select(rgb, linear_to_srgb_fast(c), c));
+    }
+}
+
+template<>
+inline void linear_to_srgb8(unsigned char* out, const float* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        srgb_store8(out + i * 4, linear_to_srgb_fast(simd_load(in + i * 4)));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = linear_to_srgb8(in[i]);
+    }
+}
+
+template<>
+inline void linear_to_srgba8(unsigned char* out, const color4_t<float>* in, size_t count) {
+    auto rgb = simd_cmplt(simd_set(0, 0, 0, 1), simd_splat(0.5f));
+
+    for (size_t i = 0; i < count; ++i) {
+        auto c = simd_load(&in[i].r);
+        auto a = simd_min(simd_max(c, simd_zero()), simd_splat(1.0f));
+        srgb_store8(out + i * 4, simd_select(rgb, linear_to_srgb_fast(c), a));
+    }
+}
+#endif
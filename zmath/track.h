@@ -0,0 +1,329 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+// Keyframe tracks. Keys are sorted by strictly increasing time and sampling
+// clamps to the first and last key. A track_cursor_t remembers the segment of
+// the previous sample, so playback with advancing time costs O(1) per sample;
+// jumps backwards or far ahead fall back to a binary search.
+
+enum track_interp {
+    TRACK_STEP,
+    TRACK_LINEAR,      // lerp for vec3 tracks, nlerp for quat tracks
+    TRACK_SLERP,       // quat tracks only, see quat_t::slerp_fast
+    TRACK_HERMITE,     // vec3 tracks only, uses per-key tangents
+    TRACK_CATMULL_ROM, // vec3 tracks only, tangents from neighbouring keys
+};
+
+struct track_cursor_t {
+    size_t key;
+
+    track_cursor_t() : key(0) {}
+};
+
+// Index i of the segment [times[i], times[i + 1]] containing time, clamped
+// to [0, count - 2]. Requires count >= 2.
+template<class T>
+size_t track_find(const T* times, size_t count, T time, track_cursor_t& cursor) {
+    assert(count >= 2);
+    auto i = cursor.key;
+
+    if (i + 1 < count && time >= times[i]) {
+        // A few steps forward cover regular playback
+        for (int step = 0; step < 4; ++step) {
+            if (i + 2 >= count || time < times[i + 1]) {
+                cursor.key = i;
+                return i;
+            }
+            ++i;
+        }
+    }
+
+    i = std::upper_bound(times + 1, times + count - 1, time) - times - 1;
+    cursor.key = i;
+    return i;
+}
+
+// Position of time within segment i, in [0, 1]
+template<class T>
+T track_factor(const T* times, size_t i, T time) {
+    assert(times[i + 1] > times[i]);
+    auto u = (time - times[i]) / (times[i + 1] - times[i]);
+    return (u < 0) ? T(0) : ((u > 1) ? T(1) : u);
+}
+
+template<class T>
+struct vec3_track_t {
+    std::vector<T> times;
+    std::vector<vec3_t<T>> values;
+    std::vector<vec3_t<T>> tangents;    // derivative per unit time, TRACK_HERMITE only
+    std::vector<unsigned short> packed; // quantized values, three per key
+    vec3_t<T> origin, range;            // value = origin + packed * range / 65535
+    track_interp interp;
+
+    vec3_track_t() : interp(TRACK_LINEAR) {}
+
+    size_t size() const {
+        return times.size();
+    }
+
+    bool quantized() const {
+        return !packed.empty();
+    }
+
+    // Replaces values with 16 bits per component relative to their bounds.
+    // The error is at most half a step of range / 65535 per component.
+    void quantize() {
+        if (values.empty()) {
+            return;
+        }
+
+        auto box = compute_bounds(values.data(), values.size());
+        origin = box.min;
+        range = box.max - box.min;
+        vec3_t<T> scale(range.x > 0 ? 65535 / range.x : 0,
+                        range.y > 0 ? 65535 / range.y : 0,
+                        range.z > 0 ? 65535 / range.z : 0);
+
+        packed.resize(values.size() * 3);
+        for (size_t i = 0; i < values.size(); ++i) {
+            auto v = values[i] - origin;
+            packed[i * 3 + 0] = (unsigned short)(v.x * scale.x + T(0.5));
+            packed[i * 3 + 1] = (unsigned short)(v.y * scale.y + T(0.5));
+            packed[i * 3 + 2] = (unsigned short)(v.z * scale.z + T(0.5));
+        }
+
+        values.clear();
+        values.shrink_to_fit();
+    }
+
+    vec3_t<T> key(size_t i) const {
+        if (packed.empty()) {
+            return values[i];
+        }
+
+        const T k = T(1) / 65535;
+        return vec3_t<T>(origin.x + packed[i * 3 + 0] * range.x * k,
+                         origin.y + packed[i * 3 + 1] * range.y * k,
+                         origin.z + packed[i * 3 + 2] * range.z * k);
+    }
+
+    vec3_t<T> sample(T time, track_cursor_t& cursor) const {
+        assert(!times.empty());
+
+        if (times.size() == 1) {
+            return key(0);
+        }
+
+        auto i = track_find(times.data(), times.size(), time, cursor);
+        auto u = track_factor(times.data(), i, time);
+        auto p0 = key(i);
+        auto p1 = key(i + 1);
+
+        switch (interp) {
+        case TRACK_STEP:
+            return (u < 1) ? p0 : p1;
+
+        case TRACK_HERMITE:
+        case TRACK_CATMULL_ROM: {
+            auto dt = times[i + 1] - times[i];
+            vec3_t<T> m0, m1;
+
+            if (interp == TRACK_HERMITE) {
+                assert(tangents.size() == times.size());
+                m0 = tangents[i] * dt;
+                m1 = tangents[i + 1] * dt;
+            } else {
+                // Finite differences scaled to the segment length, one-sided
+                // at the ends of the track
+                m0 = (i > 0) ? (p1 - key(i - 1)) * (dt / (times[i + 1] - times[i - 1])) : p1 - p0;
+                m1 = (i + 2 < times.size()) ? (key(i + 2) - p0) * (dt / (times[i + 2] - times[i])) : p1 - p0;
+            }
+
+            auto u2 = u * u;
+            auto u3 = u2 * u;
+            return p0 * (2 * u3 - 3 * u2 + 1) + m0 * (u3 - 2 * u2 + u) +
+                   p1 * (3 * u2 - 2 * u3) + m1 * (u3 - u2);
+        }
+
+        default:
+            return p0 + (p1 - p0) * u;
+        }
+    }
+};
+
+template<class T>
+struct quat_track_t {
+    std::vector<T> times;
+    std::vector<quat_t<T>> values;
+    std::vector<quat48_t> packed; // quantized values, see pack_quat48
+    track_interp interp;
+
+    quat_track_t() : interp(TRACK_SLERP) {}
+
+    size_t size() const {
+        return times.size();
+    }
+
+    bool quantized() const {
+        return !packed.empty();
+    }
+
+    // Replaces values with 48-bit smallest-three encodings
+    void quantize() {
+        packed.resize(values.size());
+        pack_quats48(packed.data(), values.data(), values.size());
+        values.clear();
+        values.shrink_to_fit();
+    }
+
+    quat_t<T> key(size_t i) const {
+        return packed.empty() ? values[i] : unpack_quat48<T>(packed[i]);
+    }
+
+    quat_t<T> sample(T time, track_cursor_t& cursor) const {
+        assert(!times.empty());
+
+        if (times.size() == 1) {
+            return key(0);
+        }
+
+        auto i = track_find(times.data(), times.size(), time, cursor);
+        auto u = track_factor(times.data(), i, time);
+
+        switch (interp) {
+        case TRACK_STEP:
+            return key((u < 1) ? i : i + 1);
+
+        case TRACK_LINEAR:
+            return quat_t<T>::nlerp(key(i), key(i + 1), u);
+
+        default:
+            return quat_t<T>::slerp_fast(key(i), key(i + 1), u);
+        }
+    }
+};
+
+// Tracks of one clip, indexed by bone. An empty track leaves the bone at its
+// rest value: zero translation, identity rotation, unit scale.
+template<class T>
+struct anim_clip_t {
+    std::vector<vec3_track_t<T>> translations;
+    std::vector<quat_track_t<T>> rotations;
+    std::vector<vec3_track_t<T>> scales;
+
+    anim_clip_t() {}
+
+    explicit anim_clip_t(size_t bones) : translations(bones), rotations(bones), scales(bones) {}
+
+    size_t bones() const {
+        return rotations.size();
+    }
+};
+
+// Samples whole poses of a clip. All scratch memory is sized up front, so
+// sample() does not allocate. Interpolated rotations are gathered and blended
+// with the batch nlerp/slerp_fast.
+template<class T>
+struct pose_sampler_t {
+    std::vector<track_cursor_t> cursors; // translation, rotation and scale per bone
+    std::vector<quat_t<T>> from, to, blended;
+    std::vector<T> factors;
+    std::vector<unsigned int> slots;
+
+    pose_sampler_t() {}
+
+    explicit pose_sampler_t(size_t bones) {
+        resize(bones);
+    }
+
+    void resize(size_t bones) {
+        cursors.assign(bones * 3, track_cursor_t());
+        from.resize(bones);
+        to.resize(bones);
+        blended.resize(bones);
+        factors.resize(bones);
+        slots.resize(bones);
+    }
+
+    // Forget the cached segments, e.g. after switching clips
+    void reset() {
+        cursors.assign(cursors.size(), track_cursor_t());
+    }
+
+    // Any of the outputs may be null to skip that channel
+    void sample(const anim_clip_t<T>& clip, T time, vec3_t<T>* translations, quat_t<T>* rotations, vec3_t<T>* scales) {
+        auto bones = clip.bones();
+        assert(bones * 3 <= cursors.size());
+        assert(clip.translations.size() == bones && clip.scales.size() == bones);
+
+        for (size_t b = 0; b < bones; ++b) {
+            if (translations) {
+                auto& track = clip.translations[b];
+                translations[b] = track.times.empty() ? vec3_t<T>(0, 0, 0) : track.sample(time, cursors[b * 3]);
+            }
+
+            if (scales) {
+                auto& track = clip.scales[b];
+                scales[b] = track.times.empty() ? vec3_t<T>(1, 1, 1) : track.sample(time, cursors[b * 3 + 2]);
+            }
+        }
+
+        if (!rotations) {
+            return;
+        }
+
+        // Slerp segments fill the scratch arrays from the front, nlerp
+        // segments from the back
+        size_t head = 0, tail = bones;
+
+        for (size_t b = 0; b < bones; ++b) {
+            auto& track = clip.rotations[b];
+
+            if (track.times.size() < 2 || track.interp == TRACK_STEP) {
+                rotations[b] = track.times.empty() ? quat_t<T>() : track.sample(time, cursors[b * 3 + 1]);
+                continue;
+            }
+
+            auto i = track_find(track.times.data(), track.times.size(), time, cursors[b * 3 + 1]);
+            auto slot = (track.interp == TRACK_LINEAR) ? --tail : head++;
+            from[slot] = track.key(i);
+            to[slot] = track.key(i + 1);
+            factors[slot] = track_factor(track.times.data(), i, time);
+            slots[slot] = (unsigned int)b;
+        }
+
+        slerp_fast(blended.data(), from.data(), to.data(), factors.data(), head);
+        nlerp(blended.data() + tail, from.data() + tail, to.data() + tail, factors.data() + tail, bones - tail);
+
+        for (size_t s = 0; s < head; ++s) {
+            rotations[slots[s]] = blended[s];
+        }
+
+        for (size_t s = tail; s < bones; ++s) {
+            rotations[slots[s]] = blended[s];
+        }
+    }
+};
@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2009-2015 Sergey Chelombitko
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+#pragma once
+
+// Array transforms. Strides are given in bytes, so the input and output may be
+// interleaved with other vertex attributes; out may alias in.
+
+// (x, y, z, 1) * m without the homogeneous divide, i.e. for affine matrices
+template<class T>
+void transform_points(vec3_t<T>* out, size_t outStride, const vec3_t<T>* in, size_t inStride, const mat4x4_t<T>& m, size_t count) {
+    auto dst = reinterpret_cast<char*>(out);
+    auto src = reinterpret_cast<const char*>(in);
+
+    for (size_t i = 0; i < count; ++i, dst += outStride, src += inStride) {
+        auto v = *reinterpret_cast<const vec3_t<T>*>(src);
+        *reinterpret_cast<vec3_t<T>*>(dst) = vec3_t<T>(v.x * m.m11 + v.y * m.m21 + v.z * m.m31 + m.m41,
+                                                       v.x * m.m12 + v.y * m.m22 + v.z * m.m32 + m.m42,
+                                                       v.x * m.m13 + v.y * m.m23 + v.z * m.m33 + m.m43);
+    }
+}
+
+template<class T>
+void transform_points(vec4_t<T>* out, size_t outStride, const vec4_t<T>* in, size_t inStride, const mat4x4_t<T>& m, size_t count) {
+    auto dst = reinterpret_cast<char*>(out);
+    auto src = reinterpret_cast<const char*>(in);
+
+    for (size_t i = 0; i < count; ++i, dst += outStride, src += inStride) {
+        *reinterpret_cast<vec4_t<T>*>(dst) = *reinterpret_cast<const vec4_t<T>*>(src) * m;
+    }
+}
+
+// (x, y, z, 0) * m, i.e. directions are not translated
+template<class T>
+void transform_vectors(vec3_t<T>* out, size_t outStride, const vec3_t<T>* in, size_t inStride, const mat4x4_t<T>& m, size_t count) {
+    auto dst = reinterpret_cast<char*>(out);
+    auto src = reinterpret_cast<const char*>(in);
+
+    for (size_t i = 0; i < count; ++i, dst += outStride, src += inStride) {
+        auto v = *reinterpret_cast<const vec3_t<T>*>(src);
+        *reinterpret_cast<vec3_t<T>*>(dst) = vec3_t<T>(v.x * m.m11 + v.y * m.m21 + v.z * m.m31,
+                                                       v.x * m.m12 + v.y * m.m22 + v.z * m.m32,
+                                                       v.x * m.m13 + v.y * m.m23 + v.z * m.m33);
+    }
+}
+
+// (x, y, z, 1) * m followed by the divide by w. Unlike vec3_t * mat4x4_t a zero w
+// is not checked for and yields non-finite results.
+template<class T>
+void transform_coords(vec3_t<T>* out, size_t outStride, const vec3_t<T>* in, size_t inStride, const mat4x4_t<T>& m, size_t count) {
+    auto dst = reinterpret_cast<char*>(out);
+    auto src = reinterpret_cast<const char*>(in);
+
+    for (size_t i = 0; i < count; ++i, dst += outStride, src += inStride) {
+        auto v = *reinterpret_cast<const vec3_t<T>*>(src);
+        auto h = 1 / (v.x * m.m14 + v.y * m.m24 + v.z * m.m34 + m.m44);
+        *reinterpret_cast<vec3_t<T>*>(dst) = vec3_t<T>((v.x * m.m11 + v.y * m.m21 + v.z * m.m31 + m.m41) * h,
+                                                       (v.x * m.m12 + v.y * m.m22 + v.z * m.m32 + m.m42) * h,
+                                                       (v.x * m.m13 + v.y * m.m23 + v.z * m.m33 + m.m43) * h);
+    }
+}
+
+// Tightly packed arrays
+template<class T>
+void transform_points(vec3_t<T>* out, const vec3_t<T>* in, const mat4x4_t<T>& m, size_t count) {
+    transform_points(out, sizeof(vec3_t<T>), in, sizeof(vec3_t<T>), m, count);
+}
+
+template<class T>
+void transform_points(vec4_t<T>* out, const vec4_t<T>* in, const mat4x4_t<T>& m, size_t count) {
+    transform_points(out, sizeof(vec4_t<T>), in, sizeof(vec4_t<T>), m, count);
+}
+
+template<class T>
+void transform_vectors(vec3_t<T>* out, const vec3_t<T>* in, const mat4x4_t<T>& m, size_t count) {
+    transform_vectors(out, sizeof(vec3_t<T>), in, sizeof(vec3_t<T>), m, count);
+}
+
+template<class T>
+void transform_coords(vec3_t<T>* out, const vec3_t<T>* in, const mat4x4_t<T>& m, size_t count) {
+    transform_coords(out, sizeof(vec3_t<T>), in, sizeof(vec3_t<T>), m, count);
+}
+
+#if defined(ZMATH_SIMD)
+// The matrix rows stay in registers for the whole array; every point is
+// expanded as x * row1 + y * row2 + z * row3 (+ row4).
+template<>
+inline void transform_points(vec3_t<float>* out, size_t outStride, const vec3_t<float>* in, size_t inStride, const mat4x4_t<float>& m, size_t count) {
+    auto r1 = simd_load(m.m[0]);
+    auto r2 = simd_load(m.m[1]);
+    auto r3 = simd_load(m.m[2]);
+    auto r4 = simd_load(m.m[3]);
+    auto dst = reinterpret_cast<char*>(out);
+    auto src = reinterpret_cast<const char*>(in);
+
+    for (size_t i = 0; i < count; ++i, dst += outStride, src += inStride) {
+        auto p = reinterpret_cast<const float*>(src);
+        auto v = simd_madd(simd_splat(p[0]), r1, r4);
+        v = simd_madd(simd_splat(p[1]), r2, v);
+        v = simd_madd(simd_splat(p[2]), r3, v);
+        simd_store3(reinterpret_cast<float*>(dst), v);
+    }
+}
+
+template<>
+inline void transform_points(vec4_t<float>* out, size_t outStride, const vec4_t<float>* in, size_t inStride, const mat4x4_t<float>& m, size_t count) {
+    auto r1 = simd_load(m.m[0]);
+    auto r2 = simd_load(m.m[1]);
+    auto r3 = simd_load(m.m[2]);
+    auto r4 = simd_load(m.m[3]);
+    auto dst = reinterpret_cast<char*>(out);
+    auto src = reinterpret_cast<const char*>(in);
+
+    for (size_t i = 0; i < count; ++i, dst += outStride, src += inStride) {
+        auto p = reinterpret_cast<const float*>(src);
+        auto v = simd_mul(simd_splat(p[0]), r1);
+        v = simd_madd(simd_splat(p[1]), r2, v);
+        v = simd_madd(simd_splat(p[2]), r3, v);
+        v = simd_madd(simd_splat(p[3]), r4, v);
+        simd_store(reinterpret_cast<float*>(dst), v);
+    }
+}
+
+template<>
+inline void transform_vectors(vec3_t<float>* out, size_t outStride, const vec3_t<float>* in, size_t inStride, const mat4x4_t<float>& m, size_t count) {
+    auto r1 = simd_load(m.m[0]);
+    auto r2 = simd_load(m.m[1]);
+    auto r3 = simd_load(m.m[2]);
+    auto dst = reinterpret_cast<char*>(out);
+    auto src = reinterpret_cast<const char*>(in);
+
+    for (size_t i = 0; i < count; ++i, dst += outStride, src += inStride) {
+        auto p = reinterpret_cast<const float*>(src);
+        auto v = simd_mul(simd_splat(p[0]), r1);
+        v = simd_madd(simd_splat(p[1]), r2, v);
+        v = simd_madd(simd_splat(p[2]), r3, v);
+        simd_store3(reinterpret_cast<float*>(dst), v);
+    }
+}
+
+template<>
+inline void transform_coords(vec3_t<float>* out, size_t outStride, const vec3_t<float>* in, size_t inStride, const mat4x4_t<float>& m, size_t count) {
+    auto r1 = simd_load(m.m[0]);
+    auto r2 = simd_load(m.m[1]);
+    auto r3 = simd_load(m.m[2]);
+    auto r4 = simd_load(m.m[3]);
+    auto dst = reinterpret_cast<char*>(out);
+    auto src = reinterpret_cast<const char*>(in);
+
+    for (size_t i = 0; i < count; ++i, dst += outStride, src += inStride) {
+        auto p = reinterpret_cast<const float*>(src);
+        auto v = simd_madd(simd_splat(p[0]), r1, r4);
+        v = simd_madd(simd_splat(p[1]), r2, v);
+        v = simd_madd(simd_splat(p[2]), r3, v);
+        simd_store3(reinterpret_cast<float*>(dst), simd_div(v, simd_wwww(v)));
+    }
+}
+#endif
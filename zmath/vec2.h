@@ -27,20 +27,22 @@ struct vec2_t {
 
     // Constructors
     vec2_t() {}
-    vec2_t(T x, T y) : x(x), y(y) {}
-    explicit vec2_t(const T* p) : x(p[0]), y(p[1]) {}
+    ZMATH_CONSTEXPR vec2_t(T x, T y) : x(x), y(y) {}
+    explicit ZMATH_CONSTEXPR vec2_t(const T* p) : x(p[0]), y(p[1]) {}
+    template<class U>
+    explicit ZMATH_CONSTEXPR vec2_t(const vec2_t<U>& v) : x(T(v.x)), y(T(v.y)) {}
 
     // Unary operators
-    vec2_t operator - () const {
+    ZMATH_CONSTEXPR vec2_t operator - () const {
         return vec2_t(-x, -y);
     }
 
     // Binary operators
-    vec2_t operator * (T f) const {
+    ZMATH_CONSTEXPR vec2_t operator * (T f) const {
         return vec2_t(x * f, y * f);
     }
 
-    friend vec2_t operator * (T f, const vec2_t& v) {
+    friend ZMATH_CONSTEXPR vec2_t operator * (T f, const vec2_t& v) {
         return vec2_t(v.x * f, v.y * f);
     }
 
@@ -55,7 +57,7 @@ struct vec2_t {
         return vec2_t(f / v.x, f / v.y);
     }
 
-    vec2_t& operator *= (T f) {
+    ZMATH_CONSTEXPR14 vec2_t& operator *= (T f) {
         x *= f;
         y *= f;
         return *this;
@@ -68,15 +70,15 @@ struct vec2_t {
         return *this;
     }
 
-    vec2_t operator + (const vec2_t& v) const {
+    ZMATH_CONSTEXPR vec2_t operator + (const vec2_t& v) const {
         return vec2_t(x + v.x, y + v.y);
     }
 
-    vec2_t operator - (const vec2_t& v) const {
+    ZMATH_CONSTEXPR vec2_t operator - (const vec2_t& v) const {
         return vec2_t(x - v.x, y - v.y);
     }
 
-    vec2_t operator * (const vec2_t& v) const {
+    ZMATH_CONSTEXPR vec2_t operator * (const vec2_t& v) const {
         return vec2_t(x * v.x, y * v.y);
     }
 
@@ -86,19 +88,19 @@ struct vec2_t {
         return vec2_t(x / v.x, y / v.y);
     }
 
-    vec2_t& operator += (const vec2_t& v) {
+    ZMATH_CONSTEXPR14 vec2_t& operator += (const vec2_t& v) {
         x += v.x;
         y += v.y;
         return *this;
     }
 
-    vec2_t& operator -= (const vec2_t& v) {
+    ZMATH_CONSTEXPR14 vec2_t& operator -= (const vec2_t& v) {
         x -= v.x;
         y -= v.y;
         return *this;
     }
 
-    vec2_t& operator *= (const vec2_t& v) {
+    ZMATH_CONSTEXPR14 vec2_t& operator *= (const vec2_t& v) {
         x *= v.x;
         y *= v.y;
         return *this;
@@ -112,7 +114,7 @@ struct vec2_t {
         return *this;
     }
 
-    vec2_t operator * (const mat2x2_t<T>& m) const {
+    ZMATH_CONSTEXPR vec2_t operator * (const mat2x2_t<T>& m) const {
         return vec2_t(x * m.m11 + y * m.m21,
                       x * m.m12 + y * m.m22);
     }
@@ -124,7 +126,7 @@ struct vec2_t {
                       (x * m.m12 + y * m.m22 + m.m32) / h);
     }
 
-    vec2_t& operator *= (const mat2x2_t<T>& m) {
+    ZMATH_CONSTEXPR14 vec2_t& operator *= (const mat2x2_t<T>& m) {
         auto vx = x * m.m11 + y * m.m21;
         auto vy = x * m.m12 + y * m.m22;
         x = vx;
@@ -143,15 +145,15 @@ struct vec2_t {
         return *this;
     }
 
-    bool operator == (const vec2_t& v) const {
+    ZMATH_CONSTEXPR bool operator == (const vec2_t& v) const {
         return x == v.x && y == v.y;
     }
 
-    bool operator != (const vec2_t& v) const {
+    ZMATH_CONSTEXPR bool operator != (const vec2_t& v) const {
         return x != v.x || y != v.y;
     }
 
-    bool operator < (const vec2_t& v) const {
+    ZMATH_CONSTEXPR bool operator < (const vec2_t& v) const {
         return x < v.x && y < v.y;
     }
 
@@ -170,38 +172,38 @@ struct vec2_t {
     }
 
     // Swizzles
-    vec2_t<T> xx()   const { return vec2_t<T>(x, x);       }
-    vec2_t<T> xy()   const { return vec2_t<T>(x, y);       }
-    vec2_t<T> yx()   const { return vec2_t<T>(y, x);       }
-    vec2_t<T> yy()   const { return vec2_t<T>(y, y);       }
-    vec3_t<T> xxx()  const { return vec3_t<T>(x, x, x);    }
-    vec3_t<T> xxy()  const { return vec3_t<T>(x, x, y);    }
-    vec3_t<T> xyx()  const { return vec3_t<T>(x, y, x);    }
-    vec3_t<T> xyy()  const { return vec3_t<T>(x, y, y);    }
-    vec3_t<T> yxx()  const { return vec3_t<T>(y, x, x);    }
-    vec3_t<T> yxy()  const { return vec3_t<T>(y, x, y);    }
-    vec3_t<T> yyx()  const { return vec3_t<T>(y, y, x);    }
-    vec3_t<T> yyy()  const { return vec3_t<T>(y, y, y);    }
-    vec4_t<T> xxxx() const { return vec4_t<T>(x, x, x, x); }
-    vec4_t<T> xxxy() const { return vec4_t<T>(x, x, x, y); }
-    vec4_t<T> xxyx() const { return vec4_t<T>(x, x, y, x); }
-    vec4_t<T> xxyy() const { return vec4_t<T>(x, x, y, y); }
-    vec4_t<T> xyxx() const { return vec4_t<T>(x, y, x, x); }
-    vec4_t<T> xyxy() const { return vec4_t<T>(x, y, x, y); }
-    vec4_t<T> xyyx() const { return vec4_t<T>(x, y, y, x); }
-    vec4_t<T> xyyy() const { return vec4_t<T>(x, y, y, y); }
-    vec4_t<T> yxxx() const { return vec4_t<T>(y, x, x, x); }
-    vec4_t<T> yxxy() const { return vec4_t<T>(y, x, x, y); }
-    vec4_t<T> yxyx() const { return vec4_t<T>(y, x, y, x); }
-    vec4_t<T> yxyy() const { return vec4_t<T>(y, x, y, y); }
-    vec4_t<T> yyxx() const { return vec4_t<T>(y, y, x, x); }
-    vec4_t<T> yyxy() const { return vec4_t<T>(y, y, x, y); }
-    vec4_t<T> yyyx() const { return vec4_t<T>(y, y, y, x); }
-    vec4_t<T> yyyy() const { return vec4_t<T>(y, y, y, y); }
+    ZMATH_CONSTEXPR vec2_t<T> xx()   const { return vec2_t<T>(x, x);       }
+    ZMATH_CONSTEXPR vec2_t<T> xy()   const { return vec2_t<T>(x, y);       }
+    ZMATH_CONSTEXPR vec2_t<T> yx()   const { return vec2_t<T>(y, x);       }
+    ZMATH_CONSTEXPR vec2_t<T> yy()   const { return vec2_t<T>(y, y);       }
+    ZMATH_CONSTEXPR vec3_t<T> xxx()  const { return vec3_t<T>(x, x, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> xxy()  const { return vec3_t<T>(x, x, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> xyx()  const { return vec3_t<T>(x, y, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> xyy()  const { return vec3_t<T>(x, y, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> yxx()  const { return vec3_t<T>(y, x, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> yxy()  const { return vec3_t<T>(y, x, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> yyx()  const { return vec3_t<T>(y, y, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> yyy()  const { return vec3_t<T>(y, y, y);    }
+    ZMATH_CONSTEXPR vec4_t<T> xxxx() const { return vec4_t<T>(x, x, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xxxy() const { return vec4_t<T>(x, x, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xxyx() const { return vec4_t<T>(x, x, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xxyy() const { return vec4_t<T>(x, x, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xyxx() const { return vec4_t<T>(x, y, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xyxy() const { return vec4_t<T>(x, y, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xyyx() const { return vec4_t<T>(x, y, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xyyy() const { return vec4_t<T>(x, y, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yxxx() const { return vec4_t<T>(y, x, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yxxy() const { return vec4_t<T>(y, x, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yxyx() const { return vec4_t<T>(y, x, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yxyy() const { return vec4_t<T>(y, x, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yyxx() const { return vec4_t<T>(y, y, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yyxy() const { return vec4_t<T>(y, y, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yyyx() const { return vec4_t<T>(y, y, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yyyy() const { return vec4_t<T>(y, y, y, y); }
 };
 
 template<class T>
-T dot(const vec2_t<T>& v1, const vec2_t<T>& v2) {
+ZMATH_CONSTEXPR T dot(const vec2_t<T>& v1, const vec2_t<T>& v2) {
     return v1.x * v2.x + v1.y * v2.y;
 }
 
@@ -218,14 +220,31 @@ vec2_t<T> normalize(const vec2_t<T>& v) {
     return vec2_t<T>(v.x * m, v.y * m);
 }
 
+// normalize with the reciprocal square root estimate of rsqrt_fast. Vectors
+// no longer than epsilon become zero, as in normalize.
 template<class T>
-vec2_t<T> minimize(const vec2_t<T>& v1, const vec2_t<T>& v2) {
+vec2_t<T> normalize_fast(const vec2_t<T>& v) {
+    auto d = dot(v, v);
+    auto m = (d > sqr(std::numeric_limits<T>::epsilon())) ? rsqrt_fast(d) : T(0);
+    return vec2_t<T>(v.x * m, v.y * m);
+}
+
+// Array version; out may alias in
+template<class T>
+void normalize_fast(vec2_t<T>* out, const vec2_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = normalize_fast(in[i]);
+    }
+}
+
+template<class T>
+ZMATH_CONSTEXPR vec2_t<T> minimize(const vec2_t<T>& v1, const vec2_t<T>& v2) {
     return vec2_t<T>((v1.x < v2.x) ? v1.x : v2.x,
                      (v1.y < v2.y) ? v1.y : v2.y);
 }
 
 template<class T>
-vec2_t<T> maximize(const vec2_t<T>& v1, const vec2_t<T>& v2) {
+ZMATH_CONSTEXPR vec2_t<T> maximize(const vec2_t<T>& v1, const vec2_t<T>& v2) {
     return vec2_t<T>((v1.x > v2.x) ? v1.x : v2.x,
                      (v1.y > v2.y) ? v1.y : v2.y);
 }
@@ -236,36 +255,58 @@ T length(const vec2_t<T>& v) {
 }
 
 template<class T>
-T length2(const vec2_t<T>& v) {
+ZMATH_CONSTEXPR T length2(const vec2_t<T>& v) {
     return v.x*v.x + v.y*v.y;
 }
 
 template<class T>
-vec2_t<T> abs(const vec2_t<T>& v) {
+ZMATH_CONSTEXPR vec2_t<T> abs(const vec2_t<T>& v) {
     return vec2_t<T>((v.x < 0) ? -v.x : v.x,
                      (v.y < 0) ? -v.y : v.y);
 }
 
 template<class T>
-vec2_t<T> clamp(const vec2_t<T>& v, T min, T max) {
+ZMATH_CONSTEXPR vec2_t<T> clamp(const vec2_t<T>& v, T min, T max) {
     return vec2_t<T>((v.x < min) ? min : ((v.x > max) ? max : v.x),
                      (v.y < min) ? min : ((v.y > max) ? max : v.y));
 }
 
 template<class T>
-vec2_t<T> clamp(const vec2_t<T>& v, const vec2_t<T>& min, const vec2_t<T>& max) {
+ZMATH_CONSTEXPR vec2_t<T> clamp(const vec2_t<T>& v, const vec2_t<T>& min, const vec2_t<T>& max) {
     return vec2_t<T>((v.x < min.x) ? min.x : ((v.x > max.x) ? max.x : v.x),
                      (v.y < min.y) ? min.y : ((v.y > max.y) ? max.y : v.y));
 }
 
 template<class T>
-vec2_t<T> lerp(const vec2_t<T>& min, const vec2_t<T>& max, T scale) {
+ZMATH_CONSTEXPR vec2_t<T> lerp(const vec2_t<T>& min, const vec2_t<T>& max, T scale) {
     return vec2_t<T>(min.x + scale * (max.x - min.x),
                      min.y + scale * (max.y - min.y));
 }
 
 template<class T>
-vec2_t<T> saturate(const vec2_t<T>& v) {
+ZMATH_CONSTEXPR vec2_t<T> saturate(const vec2_t<T>& v) {
     return vec2_t<T>((v.x < 0) ? 0 : ((v.x > 1) ? 1 : v.x),
                      (v.y < 0) ? 0 : ((v.y > 1) ? 1 : v.y));
 }
+
+#if defined(ZMATH_SIMD)
+// Four vectors per iteration, two per register
+template<>
+inline void normalize_fast(vec2_t<float>* out, const vec2_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        auto v0 = simd_load(&in[i * 4].x);
+        auto v1 = simd_load(&in[i * 4 + 2].x);
+        auto x = simd_shuffle<0, 2, 0, 2>(v0, v1);
+        auto y = simd_shuffle<1, 3, 1, 3>(v0, v1);
+        auto m = simd_normalize_scale(simd_madd(x, x, simd_mul(y, y)));
+        simd_store(&out[i * 4].x, simd_mul(v0, simd_shuffle<0, 0, 1, 1>(m, m)));
+        simd_store(&out[i * 4 + 2].x, simd_mul(v1, simd_shuffle<2, 2, 3, 3>(m, m)));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = normalize_fast(in[i]);
+    }
+}
+#endif
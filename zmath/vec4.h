@@ -27,25 +27,27 @@ struct vec4_t {
 
     // Constructors
     vec4_t() {}
-    vec4_t(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}
-    vec4_t(const vec2_t<T>& v, T z, T w) : x(v.x), y(v.y), z(z), w(w) {}
-    vec4_t(T x, const vec2_t<T>& v, T w) : x(x), y(v.x), z(v.y), w(w) {}
-    vec4_t(T x, T y, const vec2_t<T>& v) : x(x), y(y), z(v.x), w(v.y) {}
-    vec4_t(const vec3_t<T>& v, T w) : x(v.x), y(v.y), z(v.z), w(w) {}
-    vec4_t(T x, const vec3_t<T>& v) : x(x), y(v.x), z(v.y), w(v.z) {}
-    explicit vec4_t(const T* p) : x(p[0]), y(p[1]), z(p[2]), w(p[3]) {}
+    ZMATH_CONSTEXPR vec4_t(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}
+    ZMATH_CONSTEXPR vec4_t(const vec2_t<T>& v, T z, T w) : x(v.x), y(v.y), z(z), w(w) {}
+    ZMATH_CONSTEXPR vec4_t(T x, const vec2_t<T>& v, T w) : x(x), y(v.x), z(v.y), w(w) {}
+    ZMATH_CONSTEXPR vec4_t(T x, T y, const vec2_t<T>& v) : x(x), y(y), z(v.x), w(v.y) {}
+    ZMATH_CONSTEXPR vec4_t(const vec3_t<T>& v, T w) : x(v.x), y(v.y), z(v.z), w(w) {}
+    ZMATH_CONSTEXPR vec4_t(T x, const vec3_t<T>& v) : x(x), y(v.x), z(v.y), w(v.z) {}
+    explicit ZMATH_CONSTEXPR vec4_t(const T* p) : x(p[0]), y(p[1]), z(p[2]), w(p[3]) {}
+    template<class U>
+    explicit ZMATH_CONSTEXPR vec4_t(const vec4_t<U>& v) : x(T(v.x)), y(T(v.y)), z(T(v.z)), w(T(v.w)) {}
 
     // Unary operators
-    vec4_t operator - () const {
+    ZMATH_CONSTEXPR vec4_t operator - () const {
         return vec4_t(-x, -y, -z, -w);
     }
 
     // Binary operators
-    vec4_t operator * (T f) const {
+    ZMATH_CONSTEXPR vec4_t operator * (T f) const {
         return vec4_t(x * f, y * f, z * f, w * f);
     }
 
-    friend vec4_t operator * (T f, const vec4_t& v) {
+    friend ZMATH_CONSTEXPR vec4_t operator * (T f, const vec4_t& v) {
         return vec4_t(v.x * f, v.y * f, v.z * f, v.w * f);
     }
 
@@ -54,7 +56,7 @@ struct vec4_t {
         return vec4_t(x / f, y / f, z / f, w / f);
     }
 
-    vec4_t& operator *= (T f) {
+    ZMATH_CONSTEXPR14 vec4_t& operator *= (T f) {
         x *= f;
         y *= f;
         z *= f;
@@ -71,15 +73,15 @@ struct vec4_t {
         return *this;
     }
 
-    vec4_t operator + (const vec4_t& v) const {
+    ZMATH_CONSTEXPR vec4_t operator + (const vec4_t& v) const {
         return vec4_t(x + v.x, y + v.y, z + v.z, w + v.w);
     }
 
-    vec4_t operator - (const vec4_t& v) const {
+    ZMATH_CONSTEXPR vec4_t operator - (const vec4_t& v) const {
         return vec4_t(x - v.x, y - v.y, z - v.z, w - v.w);
     }
 
-    vec4_t operator * (const vec4_t& v) const {
+    ZMATH_CONSTEXPR vec4_t operator * (const vec4_t& v) const {
         return vec4_t(x * v.x, y * v.y, z * v.z, w * v.w);
     }
 
@@ -91,7 +93,7 @@ struct vec4_t {
         return vec4_t(x / v.x, y / v.y, z / v.z, w / v.w);
     }
 
-    vec4_t& operator += (const vec4_t& v) {
+    ZMATH_CONSTEXPR14 vec4_t& operator += (const vec4_t& v) {
         x += v.x;
         y += v.y;
         z += v.z;
@@ -99,7 +101,7 @@ struct vec4_t {
         return *this;
     }
 
-    vec4_t& operator -= (const vec4_t& v) {
+    ZMATH_CONSTEXPR14 vec4_t& operator -= (const vec4_t& v) {
         x -= v.x;
         y -= v.y;
         z -= v.z;
@@ -107,7 +109,7 @@ struct vec4_t {
         return *this;
     }
 
-    vec4_t& operator *= (const vec4_t& v) {
+    ZMATH_CONSTEXPR14 vec4_t& operator *= (const vec4_t& v) {
         x *= v.x;
         y *= v.y;
         z *= v.z;
@@ -146,15 +148,15 @@ struct vec4_t {
         return *this;
     }
 
-    bool operator == (const vec4_t& v) const {
+    ZMATH_CONSTEXPR bool operator == (const vec4_t& v) const {
         return x == v.x && y == v.y && z == v.z && w == v.w;
     }
 
-    bool operator != (const vec4_t& v) const {
+    ZMATH_CONSTEXPR bool operator != (const vec4_t& v) const {
         return x != v.x || y != v.y || z != v.z || w != v.w;
     }
 
-    bool operator < (const vec4_t& v) const {
+    ZMATH_CONSTEXPR bool operator < (const vec4_t& v) const {
         return x < v.x && y < v.y && z < v.z && w < v.w;
     }
 
@@ -173,346 +175,346 @@ struct vec4_t {
     }
 
     // Swizzles
-    vec2_t<T> xx()   const { return vec2_t<T>(x, x);       }
-    vec2_t<T> xy()   const { return vec2_t<T>(x, y);       }
-    vec2_t<T> xz()   const { return vec2_t<T>(x, z);       }
-    vec2_t<T> xw()   const { return vec2_t<T>(x, w);       }
-    vec2_t<T> yx()   const { return vec2_t<T>(y, x);       }
-    vec2_t<T> yy()   const { return vec2_t<T>(y, y);       }
-    vec2_t<T> yz()   const { return vec2_t<T>(y, z);       }
-    vec2_t<T> yw()   const { return vec2_t<T>(y, w);       }
-    vec2_t<T> zx()   const { return vec2_t<T>(z, x);       }
-    vec2_t<T> zy()   const { return vec2_t<T>(z, y);       }
-    vec2_t<T> zz()   const { return vec2_t<T>(z, z);       }
-    vec2_t<T> zw()   const { return vec2_t<T>(z, w);       }
-    vec2_t<T> wx()   const { return vec2_t<T>(w, x);       }
-    vec2_t<T> wy()   const { return vec2_t<T>(w, y);       }
-    vec2_t<T> wz()   const { return vec2_t<T>(w, z);       }
-    vec2_t<T> ww()   const { return vec2_t<T>(w, w);       }
-    vec3_t<T> xxx()  const { return vec3_t<T>(x, x, x);    }
-    vec3_t<T> xxy()  const { return vec3_t<T>(x, x, y);    }
-    vec3_t<T> xxz()  const { return vec3_t<T>(x, x, z);    }
-    vec3_t<T> xxw()  const { return vec3_t<T>(x, x, w);    }
-    vec3_t<T> xyx()  const { return vec3_t<T>(x, y, x);    }
-    vec3_t<T> xyy()  const { return vec3_t<T>(x, y, y);    }
-    vec3_t<T> xyz()  const { return vec3_t<T>(x, y, z);    }
-    vec3_t<T> xyw()  const { return vec3_t<T>(x, y, w);    }
-    vec3_t<T> xzx()  const { return vec3_t<T>(x, z, x);    }
-    vec3_t<T> xzy()  const { return vec3_t<T>(x, z, y);    }
-    vec3_t<T> xzz()  const { return vec3_t<T>(x, z, z);    }
-    vec3_t<T> xzw()  const { return vec3_t<T>(x, z, w);    }
-    vec3_t<T> xwx()  const { return vec3_t<T>(x, w, x);    }
-    vec3_t<T> xwy()  const { return vec3_t<T>(x, w, y);    }
-    vec3_t<T> xwz()  const { return vec3_t<T>(x, w, z);    }
-    vec3_t<T> xww()  const { return vec3_t<T>(x, w, w);    }
-    vec3_t<T> yxx()  const { return vec3_t<T>(y, x, x);    }
-    vec3_t<T> yxy()  const { return vec3_t<T>(y, x, y);    }
-    vec3_t<T> yxz()  const { return vec3_t<T>(y, x, z);    }
-    vec3_t<T> yxw()  const { return vec3_t<T>(y, x, w);    }
-    vec3_t<T> yyx()  const { return vec3_t<T>(y, y, x);    }
-    vec3_t<T> yyy()  const { return vec3_t<T>(y, y, y);    }
-    vec3_t<T> yyz()  const { return vec3_t<T>(y, y, z);    }
-    vec3_t<T> yyw()  const { return vec3_t<T>(y, y, w);    }
-    vec3_t<T> yzx()  const { return vec3_t<T>(y, z, x);    }
-    vec3_t<T> yzy()  const { return vec3_t<T>(y, z, y);    }
-    vec3_t<T> yzz()  const { return vec3_t<T>(y, z, z);    }
-    vec3_t<T> yzw()  const { return vec3_t<T>(y, z, w);    }
-    vec3_t<T> ywx()  const { return vec3_t<T>(y, w, x);    }
-    vec3_t<T> ywy()  const { return vec3_t<T>(y, w, y);    }
-    vec3_t<T> ywz()  const { return vec3_t<T>(y, w, z);    }
-    vec3_t<T> yww()  const { return vec3_t<T>(y, w, w);    }
-    vec3_t<T> zxx()  const { return vec3_t<T>(z, x, x);    }
-    vec3_t<T> zxy()  const { return vec3_t<T>(z, x, y);    }
-    vec3_t<T> zxz()  const { return vec3_t<T>(z, x, z);    }
-    vec3_t<T> zxw()  const { return vec3_t<T>(z, x, w);    }
-    vec3_t<T> zyx()  const { return vec3_t<T>(z, y, x);    }
-    vec3_t<T> zyy()  const { return vec3_t<T>(z, y, y);    }
-    vec3_t<T> zyz()  const { return vec3_t<T>(z, y, z);    }
-    vec3_t<T> zyw()  const { return vec3_t<T>(z, y, w);    }
-    vec3_t<T> zzx()  const { return vec3_t<T>(z, z, x);    }
-    vec3_t<T> zzy()  const { return vec3_t<T>(z, z, y);    }
-    vec3_t<T> zzz()  const { return vec3_t<T>(z, z, z);    }
-    vec3_t<T> zzw()  const { return vec3_t<T>(z, z, w);    }
-    vec3_t<T> zwx()  const { return vec3_t<T>(z, w, x);    }
-    vec3_t<T> zwy()  const { return vec3_t<T>(z, w, y);    }
-    vec3_t<T> zwz()  const { return vec3_t<T>(z, w, z);    }
-    vec3_t<T> zww()  const { return vec3_t<T>(z, w, w);    }
-    vec3_t<T> wxx()  const { return vec3_t<T>(w, x, x);    }
-    vec3_t<T> wxy()  const { return vec3_t<T>(w, x, y);    }
-    vec3_t<T> wxz()  const { return vec3_t<T>(w, x, z);    }
-    vec3_t<T> wxw()  const { return vec3_t<T>(w, x, w);    }
-    vec3_t<T> wyx()  const { return vec3_t<T>(w, y, x);    }
-    vec3_t<T> wyy()  const { return vec3_t<T>(w, y, y);    }
-    vec3_t<T> wyz()  const { return vec3_t<T>(w, y, z);    }
-    vec3_t<T> wyw()  const { return vec3_t<T>(w, y, w);    }
-    vec3_t<T> wzx()  const { return vec3_t<T>(w, z, x);    }
-    vec3_t<T> wzy()  const { return vec3_t<T>(w, z, y);    }
-    vec3_t<T> wzz()  const { return vec3_t<T>(w, z, z);    }
-    vec3_t<T> wzw()  const { return vec3_t<T>(w, z, w);    }
-    vec3_t<T> wwx()  const { return vec3_t<T>(w, w, x);    }
-    vec3_t<T> wwy()  const { return vec3_t<T>(w, w, y);    }
-    vec3_t<T> wwz()  const { return vec3_t<T>(w, w, z);    }
-    vec3_t<T> www()  const { return vec3_t<T>(w, w, w);    }
-    vec4_t<T> xxxx() const { return vec4_t<T>(x, x, x, x); }
-    vec4_t<T> xxxy() const { return vec4_t<T>(x, x, x, y); }
-    vec4_t<T> xxxz() const { return vec4_t<T>(x, x, x, z); }
-    vec4_t<T> xxxw() const { return vec4_t<T>(x, x, x, w); }
-    vec4_t<T> xxyx() const { return vec4_t<T>(x, x, y, x); }
-    vec4_t<T> xxyy() const { return vec4_t<T>(x, x, y, y); }
-    vec4_t<T> xxyz() const { return vec4_t<T>(x, x, y, z); }
-    vec4_t<T> xxyw() const { return vec4_t<T>(x, x, y, w); }
-    vec4_t<T> xxzx() const { return vec4_t<T>(x, x, z, x); }
-    vec4_t<T> xxzy() const { return vec4_t<T>(x, x, z, y); }
-    vec4_t<T> xxzz() const { return vec4_t<T>(x, x, z, z); }
-    vec4_t<T> xxzw() const { return vec4_t<T>(x, x, z, w); }
-    vec4_t<T> xxwx() const { return vec4_t<T>(x, x, w, x); }
-    vec4_t<T> xxwy() const { return vec4_t<T>(x, x, w, y); }
-    vec4_t<T> xxwz() const { return vec4_t<T>(x, x, w, z); }
-    vec4_t<T> xxww() const { return vec4_t<T>(x, x, w, w); }
-    vec4_t<T> xyxx() const { return vec4_t<T>(x, y, x, x); }
-    vec4_t<T> xyxy() const { return vec4_t<T>(x, y, x, y); }
-    vec4_t<T> xyxz() const { return vec4_t<T>(x, y, x, z); }
-    vec4_t<T> xyxw() const { return vec4_t<T>(x, y, x, w); }
-    vec4_t<T> xyyx() const { return vec4_t<T>(x, y, y, x); }
-    vec4_t<T> xyyy() const { return vec4_t<T>(x, y, y, y); }
-    vec4_t<T> xyyz() const { return vec4_t<T>(x, y, y, z); }
-    vec4_t<T> xyyw() const { return vec4_t<T>(x, y, y, w); }
-    vec4_t<T> xyzx() const { return vec4_t<T>(x, y, z, x); }
-    vec4_t<T> xyzy() const { return vec4_t<T>(x, y, z, y); }
-    vec4_t<T> xyzz() const { return vec4_t<T>(x, y, z, z); }
-    vec4_t<T> xyzw() const { return vec4_t<T>(x, y, z, w); }
-    vec4_t<T> xywx() const { return vec4_t<T>(x, y, w, x); }
-    vec4_t<T> xywy() const { return vec4_t<T>(x, y, w, y); }
-    vec4_t<T> xywz() const { return vec4_t<T>(x, y, w, z); }
-    vec4_t<T> xyww() const { return vec4_t<T>(x, y, w, w); }
-    vec4_t<T> xzxx() const { return vec4_t<T>(x, z, x, x); }
-    vec4_t<T> xzxy() const { return vec4_t<T>(x, z, x, y); }
-    vec4_t<T> xzxz() const { return vec4_t<T>(x, z, x, z); }
-    vec4_t<T> xzxw() const { return vec4_t<T>(x, z, x, w); }
-    vec4_t<T> xzyx() const { return vec4_t<T>(x, z, y, x); }
-    vec4_t<T> xzyy() const { return vec4_t<T>(x, z, y, y); }
-    vec4_t<T> xzyz() const { return vec4_t<T>(x, z, y, z); }
-    vec4_t<T> xzyw() const { return vec4_t<T>(x, z, y, w); }
-    vec4_t<T> xzzx() const { return vec4_t<T>(x, z, z, x); }
-    vec4_t<T> xzzy() const { return vec4_t<T>(x, z, z, y); }
-    vec4_t<T> xzzz() const { return vec4_t<T>(x, z, z, z); }
-    vec4_t<T> xzzw() const { return vec4_t<T>(x, z, z, w); }
-    vec4_t<T> xzwx() const { return vec4_t<T>(x, z, w, x); }
-    vec4_t<T> xzwy() const { return vec4_t<T>(x, z, w, y); }
-    vec4_t<T> xzwz() const { return vec4_t<T>(x, z, w, z); }
-    vec4_t<T> xzww() const { return vec4_t<T>(x, z, w, w); }
-    vec4_t<T> xwxx() const { return vec4_t<T>(x, w, x, x); }
-    vec4_t<T> xwxy() const { return vec4_t<T>(x, w, x, y); }
-    vec4_t<T> xwxz() const { return vec4_t<T>(x, w, x, z); }
-    vec4_t<T> xwxw() const { return vec4_t<T>(x, w, x, w); }
-    vec4_t<T> xwyx() const { return vec4_t<T>(x, w, y, x); }
-    vec4_t<T> xwyy() const { return vec4_t<T>(x, w, y, y); }
-    vec4_t<T> xwyz() const { return vec4_t<T>(x, w, y, z); }
-    vec4_t<T> xwyw() const { return vec4_t<T>(x, w, y, w); }
-    vec4_t<T> xwzx() const { return vec4_t<T>(x, w, z, x); }
-    vec4_t<T> xwzy() const { return vec4_t<T>(x, w, z, y); }
-    vec4_t<T> xwzz() const { return vec4_t<T>(x, w, z, z); }
-    vec4_t<T> xwzw() const { return vec4_t<T>(x, w, z, w); }
-    vec4_t<T> xwwx() const { return vec4_t<T>(x, w, w, x); }
-    vec4_t<T> xwwy() const { return vec4_t<T>(x, w, w, y); }
-    vec4_t<T> xwwz() const { return vec4_t<T>(x, w, w, z); }
-    vec4_t<T> xwww() const { return vec4_t<T>(x, w, w, w); }
-    vec4_t<T> yxxx() const { return vec4_t<T>(y, x, x, x); }
-    vec4_t<T> yxxy() const { return vec4_t<T>(y, x, x, y); }
-    vec4_t<T> yxxz() const { return vec4_t<T>(y, x, x, z); }
-    vec4_t<T> yxxw() const { return vec4_t<T>(y, x, x, w); }
-    vec4_t<T> yxyx() const { return vec4_t<T>(y, x, y, x); }
-    vec4_t<T> yxyy() const { return vec4_t<T>(y, x, y, y); }
-    vec4_t<T> yxyz() const { return vec4_t<T>(y, x, y, z); }
-    vec4_t<T> yxyw() const { return vec4_t<T>(y, x, y, w); }
-    vec4_t<T> yxzx() const { return vec4_t<T>(y, x, z, x); }
-    vec4_t<T> yxzy() const { return vec4_t<T>(y, x, z, y); }
-    vec4_t<T> yxzz() const { return vec4_t<T>(y, x, z, z); }
-    vec4_t<T> yxzw() const { return vec4_t<T>(y, x, z, w); }
-    vec4_t<T> yxwx() const { return vec4_t<T>(y, x, w, x); }
-    vec4_t<T> yxwy() const { return vec4_t<T>(y, x, w, y); }
-    vec4_t<T> yxwz() const { return vec4_t<T>(y, x, w, z); }
-    vec4_t<T> yxww() const { return vec4_t<T>(y, x, w, w); }
-    vec4_t<T> yyxx() const { return vec4_t<T>(y, y, x, x); }
-    vec4_t<T> yyxy() const { return vec4_t<T>(y, y, x, y); }
-    vec4_t<T> yyxz() const { return vec4_t<T>(y, y, x, z); }
-    vec4_t<T> yyxw() const { return vec4_t<T>(y, y, x, w); }
-    vec4_t<T> yyyx() const { return vec4_t<T>(y, y, y, x); }
-    vec4_t<T> yyyy() const { return vec4_t<T>(y, y, y, y); }
-    vec4_t<T> yyyz() const { return vec4_t<T>(y, y, y, z); }
-    vec4_t<T> yyyw() const { return vec4_t<T>(y, y, y, w); }
-    vec4_t<T> yyzx() const { return vec4_t<T>(y, y, z, x); }
-    vec4_t<T> yyzy() const { return vec4_t<T>(y, y, z, y); }
-    vec4_t<T> yyzz() const { return vec4_t<T>(y, y, z, z); }
-    vec4_t<T> yyzw() const { return vec4_t<T>(y, y, z, w); }
-    vec4_t<T> yywx() const { return vec4_t<T>(y, y, w, x); }
-    vec4_t<T> yywy() const { return vec4_t<T>(y, y, w, y); }
-    vec4_t<T> yywz() const { return vec4_t<T>(y, y, w, z); }
-    vec4_t<T> yyww() const { return vec4_t<T>(y, y, w, w); }
-    vec4_t<T> yzxx() const { return vec4_t<T>(y, z, x, x); }
-    vec4_t<T> yzxy() const { return vec4_t<T>(y, z, x, y); }
-    vec4_t<T> yzxz() const { return vec4_t<T>(y, z, x, z); }
-    vec4_t<T> yzxw() const { return vec4_t<T>(y, z, x, w); }
-    vec4_t<T> yzyx() const { return vec4_t<T>(y, z, y, x); }
-    vec4_t<T> yzyy() const { return vec4_t<T>(y, z, y, y); }
-    vec4_t<T> yzyz() const { return vec4_t<T>(y, z, y, z); }
-    vec4_t<T> yzyw() const { return vec4_t<T>(y, z, y, w); }
-    vec4_t<T> yzzx() const { return vec4_t<T>(y, z, z, x); }
-    vec4_t<T> yzzy() const { return vec4_t<T>(y, z, z, y); }
-    vec4_t<T> yzzz() const { return vec4_t<T>(y, z, z, z); }
-    vec4_t<T> yzzw() const { return vec4_t<T>(y, z, z, w); }
-    vec4_t<T> yzwx() const { return vec4_t<T>(y, z, w, x); }
-    vec4_t<T> yzwy() const { return vec4_t<T>(y, z, w, y); }
-    vec4_t<T> yzwz() const { return vec4_t<T>(y, z, w, z); }
-    vec4_t<T> yzww() const { return vec4_t<T>(y, z, w, w); }
-    vec4_t<T> ywxx() const { return vec4_t<T>(y, w, x, x); }
-    vec4_t<T> ywxy() const { return vec4_t<T>(y, w, x, y); }
-    vec4_t<T> ywxz() const { return vec4_t<T>(y, w, x, z); }
-    vec4_t<T> ywxw() const { return vec4_t<T>(y, w, x, w); }
-    vec4_t<T> ywyx() const { return vec4_t<T>(y, w, y, x); }
-    vec4_t<T> ywyy() const { return vec4_t<T>(y, w, y, y); }
-    vec4_t<T> ywyz() const { return vec4_t<T>(y, w, y, z); }
-    vec4_t<T> ywyw() const { return vec4_t<T>(y, w, y, w); }
-    vec4_t<T> ywzx() const { return vec4_t<T>(y, w, z, x); }
-    vec4_t<T> ywzy() const { return vec4_t<T>(y, w, z, y); }
-    vec4_t<T> ywzz() const { return vec4_t<T>(y, w, z, z); }
-    vec4_t<T> ywzw() const { return vec4_t<T>(y, w, z, w); }
-    vec4_t<T> ywwx() const { return vec4_t<T>(y, w, w, x); }
-    vec4_t<T> ywwy() const { return vec4_t<T>(y, w, w, y); }
-    vec4_t<T> ywwz() const { return vec4_t<T>(y, w, w, z); }
-    vec4_t<T> ywww() const { return vec4_t<T>(y, w, w, w); }
-    vec4_t<T> zxxx() const { return vec4_t<T>(z, x, x, x); }
-    vec4_t<T> zxxy() const { return vec4_t<T>(z, x, x, y); }
-    vec4_t<T> zxxz() const { return vec4_t<T>(z, x, x, z); }
-    vec4_t<T> zxxw() const { return vec4_t<T>(z, x, x, w); }
-    vec4_t<T> zxyx() const { return vec4_t<T>(z, x, y, x); }
-    vec4_t<T> zxyy() const { return vec4_t<T>(z, x, y, y); }
-    vec4_t<T> zxyz() const { return vec4_t<T>(z, x, y, z); }
-    vec4_t<T> zxyw() const { return vec4_t<T>(z, x, y, w); }
-    vec4_t<T> zxzx() const { return vec4_t<T>(z, x, z, x); }
-    vec4_t<T> zxzy() const { return vec4_t<T>(z, x, z, y); }
-    vec4_t<T> zxzz() const { return vec4_t<T>(z, x, z, z); }
-    vec4_t<T> zxzw() const { return vec4_t<T>(z, x, z, w); }
-    vec4_t<T> zxwx() const { return vec4_t<T>(z, x, w, x); }
-    vec4_t<T> zxwy() const { return vec4_t<T>(z, x, w, y); }
-    vec4_t<T> zxwz() const { return vec4_t<T>(z, x, w, z); }
-    vec4_t<T> zxww() const { return vec4_t<T>(z, x, w, w); }
-    vec4_t<T> zyxx() const { return vec4_t<T>(z, y, x, x); }
-    vec4_t<T> zyxy() const { return vec4_t<T>(z, y, x, y); }
-    vec4_t<T> zyxz() const { return vec4_t<T>(z, y, x, z); }
-    vec4_t<T> zyxw() const { return vec4_t<T>(z, y, x, w); }
-    vec4_t<T> zyyx() const { return vec4_t<T>(z, y, y, x); }
-    vec4_t<T> zyyy() const { return vec4_t<T>(z, y, y, y); }
-    vec4_t<T> zyyz() const { return vec4_t<T>(z, y, y, z); }
-    vec4_t<T> zyyw() const { return vec4_t<T>(z, y, y, w); }
-    vec4_t<T> zyzx() const { return vec4_t<T>(z, y, z, x); }
-    vec4_t<T> zyzy() const { return vec4_t<T>(z, y, z, y); }
-    vec4_t<T> zyzz() const { return vec4_t<T>(z, y, z, z); }
-    vec4_t<T> zyzw() const { return vec4_t<T>(z, y, z, w); }
-    vec4_t<T> zywx() const { return vec4_t<T>(z, y, w, x); }
-    vec4_t<T> zywy() const { return vec4_t<T>(z, y, w, y); }
-    vec4_t<T> zywz() const { return vec4_t<T>(z, y, w, z); }
-    vec4_t<T> zyww() const { return vec4_t<T>(z, y, w, w); }
-    vec4_t<T> zzxx() const { return vec4_t<T>(z, z, x, x); }
-    vec4_t<T> zzxy() const { return vec4_t<T>(z, z, x, y); }
-    vec4_t<T> zzxz() const { return vec4_t<T>(z, z, x, z); }
-    vec4_t<T> zzxw() const { return vec4_t<T>(z, z, x, w); }
-    vec4_t<T> zzyx() const { return vec4_t<T>(z, z, y, x); }
-    vec4_t<T> zzyy() const { return vec4_t<T>(z, z, y, y); }
-    vec4_t<T> zzyz() const { return vec4_t<T>(z, z, y, z); }
-    vec4_t<T> zzyw() const { return vec4_t<T>(z, z, y, w); }
-    vec4_t<T> zzzx() const { return vec4_t<T>(z, z, z, x); }
-    vec4_t<T> zzzy() const { return vec4_t<T>(z, z, z, y); }
-    vec4_t<T> zzzz() const { return vec4_t<T>(z, z, z, z); }
-    vec4_t<T> zzzw() const { return vec4_t<T>(z, z, z, w); }
-    vec4_t<T> zzwx() const { return vec4_t<T>(z, z, w, x); }
-    vec4_t<T> zzwy() const { return vec4_t<T>(z, z, w, y); }
-    vec4_t<T> zzwz() const { return vec4_t<T>(z, z, w, z); }
-    vec4_t<T> zzww() const { return vec4_t<T>(z, z, w, w); }
-    vec4_t<T> zwxx() const { return vec4_t<T>(z, w, x, x); }
-    vec4_t<T> zwxy() const { return vec4_t<T>(z, w, x, y); }
-    vec4_t<T> zwxz() const { return vec4_t<T>(z, w, x, z); }
-    vec4_t<T> zwxw() const { return vec4_t<T>(z, w, x, w); }
-    vec4_t<T> zwyx() const { return vec4_t<T>(z, w, y, x); }
-    vec4_t<T> zwyy() const { return vec4_t<T>(z, w, y, y); }
-    vec4_t<T> zwyz() const { return vec4_t<T>(z, w, y, z); }
-    vec4_t<T> zwyw() const { return vec4_t<T>(z, w, y, w); }
-    vec4_t<T> zwzx() const { return vec4_t<T>(z, w, z, x); }
-    vec4_t<T> zwzy() const { return vec4_t<T>(z, w, z, y); }
-    vec4_t<T> zwzz() const { return vec4_t<T>(z, w, z, z); }
-    vec4_t<T> zwzw() const { return vec4_t<T>(z, w, z, w); }
-    vec4_t<T> zwwx() const { return vec4_t<T>(z, w, w, x); }
-    vec4_t<T> zwwy() const { return vec4_t<T>(z, w, w, y); }
-    vec4_t<T> zwwz() const { return vec4_t<T>(z, w, w, z); }
-    vec4_t<T> zwww() const { return vec4_t<T>(z, w, w, w); }
-    vec4_t<T> wxxx() const { return vec4_t<T>(w, x, x, x); }
-    vec4_t<T> wxxy() const { return vec4_t<T>(w, x, x, y); }
-    vec4_t<T> wxxz() const { return vec4_t<T>(w, x, x, z); }
-    vec4_t<T> wxxw() const { return vec4_t<T>(w, x, x, w); }
-    vec4_t<T> wxyx() const { return vec4_t<T>(w, x, y, x); }
-    vec4_t<T> wxyy() const { return vec4_t<T>(w, x, y, y); }
-    vec4_t<T> wxyz() const { return vec4_t<T>(w, x, y, z); }
-    vec4_t<T> wxyw() const { return vec4_t<T>(w, x, y, w); }
-    vec4_t<T> wxzx() const { return vec4_t<T>(w, x, z, x); }
-    vec4_t<T> wxzy() const { return vec4_t<T>(w, x, z, y); }
-    vec4_t<T> wxzz() const { return vec4_t<T>(w, x, z, z); }
-    vec4_t<T> wxzw() const { return vec4_t<T>(w, x, z, w); }
-    vec4_t<T> wxwx() const { return vec4_t<T>(w, x, w, x); }
-    vec4_t<T> wxwy() const { return vec4_t<T>(w, x, w, y); }
-    vec4_t<T> wxwz() const { return vec4_t<T>(w, x, w, z); }
-    vec4_t<T> wxww() const { return vec4_t<T>(w, x, w, w); }
-    vec4_t<T> wyxx() const { return vec4_t<T>(w, y, x, x); }
-    vec4_t<T> wyxy() const { return vec4_t<T>(w, y, x, y); }
-    vec4_t<T> wyxz() const { return vec4_t<T>(w, y, x, z); }
-    vec4_t<T> wyxw() const { return vec4_t<T>(w, y, x, w); }
-    vec4_t<T> wyyx() const { return vec4_t<T>(w, y, y, x); }
-    vec4_t<T> wyyy() const { return vec4_t<T>(w, y, y, y); }
-    vec4_t<T> wyyz() const { return vec4_t<T>(w, y, y, z); }
-    vec4_t<T> wyyw() const { return vec4_t<T>(w, y, y, w); }
-    vec4_t<T> wyzx() const { return vec4_t<T>(w, y, z, x); }
-    vec4_t<T> wyzy() const { return vec4_t<T>(w, y, z, y); }
-    vec4_t<T> wyzz() const { return vec4_t<T>(w, y, z, z); }
-    vec4_t<T> wyzw() const { return vec4_t<T>(w, y, z, w); }
-    vec4_t<T> wywx() const { return vec4_t<T>(w, y, w, x); }
-    vec4_t<T> wywy() const { return vec4_t<T>(w, y, w, y); }
-    vec4_t<T> wywz() const { return vec4_t<T>(w, y, w, z); }
-    vec4_t<T> wyww() const { return vec4_t<T>(w, y, w, w); }
-    vec4_t<T> wzxx() const { return vec4_t<T>(w, z, x, x); }
-    vec4_t<T> wzxy() const { return vec4_t<T>(w, z, x, y); }
-    vec4_t<T> wzxz() const { return vec4_t<T>(w, z, x, z); }
-    vec4_t<T> wzxw() const { return vec4_t<T>(w, z, x, w); }
-    vec4_t<T> wzyx() const { return vec4_t<T>(w, z, y, x); }
-    vec4_t<T> wzyy() const { return vec4_t<T>(w, z, y, y); }
-    vec4_t<T> wzyz() const { return vec4_t<T>(w, z, y, z); }
-    vec4_t<T> wzyw() const { return vec4_t<T>(w, z, y, w); }
-    vec4_t<T> wzzx() const { return vec4_t<T>(w, z, z, x); }
-    vec4_t<T> wzzy() const { return vec4_t<T>(w, z, z, y); }
-    vec4_t<T> wzzz() const { return vec4_t<T>(w, z, z, z); }
-    vec4_t<T> wzzw() const { return vec4_t<T>(w, z, z, w); }
-    vec4_t<T> wzwx() const { return vec4_t<T>(w, z, w, x); }
-    vec4_t<T> wzwy() const { return vec4_t<T>(w, z, w, y); }
-    vec4_t<T> wzwz() const { return vec4_t<T>(w, z, w, z); }
-    vec4_t<T> wzww() const { return vec4_t<T>(w, z, w, w); }
-    vec4_t<T> wwxx() const { return vec4_t<T>(w, w, x, x); }
-    vec4_t<T> wwxy() const { return vec4_t<T>(w, w, x, y); }
-    vec4_t<T> wwxz() const { return vec4_t<T>(w, w, x, z); }
-    vec4_t<T> wwxw() const { return vec4_t<T>(w, w, x, w); }
-    vec4_t<T> wwyx() const { return vec4_t<T>(w, w, y, x); }
-    vec4_t<T> wwyy() const { return vec4_t<T>(w, w, y, y); }
-    vec4_t<T> wwyz() const { return vec4_t<T>(w, w, y, z); }
-    vec4_t<T> wwyw() const { return vec4_t<T>(w, w, y, w); }
-    vec4_t<T> wwzx() const { return vec4_t<T>(w, w, z, x); }
-    vec4_t<T> wwzy() const { return vec4_t<T>(w, w, z, y); }
-    vec4_t<T> wwzz() const { return vec4_t<T>(w, w, z, z); }
-    vec4_t<T> wwzw() const { return vec4_t<T>(w, w, z, w); }
-    vec4_t<T> wwwx() const { return vec4_t<T>(w, w, w, x); }
-    vec4_t<T> wwwy() const { return vec4_t<T>(w, w, w, y); }
-    vec4_t<T> wwwz() const { return vec4_t<T>(w, w, w, z); }
-    vec4_t<T> wwww() const { return vec4_t<T>(w, w, w, w); }
+    ZMATH_CONSTEXPR vec2_t<T> xx()   const { return vec2_t<T>(x, x);       }
+    ZMATH_CONSTEXPR vec2_t<T> xy()   const { return vec2_t<T>(x, y);       }
+    ZMATH_CONSTEXPR vec2_t<T> xz()   const { return vec2_t<T>(x, z);       }
+    ZMATH_CONSTEXPR vec2_t<T> xw()   const { return vec2_t<T>(x, w);       }
+    ZMATH_CONSTEXPR vec2_t<T> yx()   const { return vec2_t<T>(y, x);       }
+    ZMATH_CONSTEXPR vec2_t<T> yy()   const { return vec2_t<T>(y, y);       }
+    ZMATH_CONSTEXPR vec2_t<T> yz()   const { return vec2_t<T>(y, z);       }
+    ZMATH_CONSTEXPR vec2_t<T> yw()   const { return vec2_t<T>(y, w);       }
+    ZMATH_CONSTEXPR vec2_t<T> zx()   const { return vec2_t<T>(z, x);       }
+    ZMATH_CONSTEXPR vec2_t<T> zy()   const { return vec2_t<T>(z, y);       }
+    ZMATH_CONSTEXPR vec2_t<T> zz()   const { return vec2_t<T>(z, z);       }
+    ZMATH_CONSTEXPR vec2_t<T> zw()   const { return vec2_t<T>(z, w);       }
+    ZMATH_CONSTEXPR vec2_t<T> wx()   const { return vec2_t<T>(w, x);       }
+    ZMATH_CONSTEXPR vec2_t<T> wy()   const { return vec2_t<T>(w, y);       }
+    ZMATH_CONSTEXPR vec2_t<T> wz()   const { return vec2_t<T>(w, z);       }
+    ZMATH_CONSTEXPR vec2_t<T> ww()   const { return vec2_t<T>(w, w);       }
+    ZMATH_CONSTEXPR vec3_t<T> xxx()  const { return vec3_t<T>(x, x, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> xxy()  const { return vec3_t<T>(x, x, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> xxz()  const { return vec3_t<T>(x, x, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> xxw()  const { return vec3_t<T>(x, x, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> xyx()  const { return vec3_t<T>(x, y, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> xyy()  const { return vec3_t<T>(x, y, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> xyz()  const { return vec3_t<T>(x, y, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> xyw()  const { return vec3_t<T>(x, y, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> xzx()  const { return vec3_t<T>(x, z, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> xzy()  const { return vec3_t<T>(x, z, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> xzz()  const { return vec3_t<T>(x, z, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> xzw()  const { return vec3_t<T>(x, z, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> xwx()  const { return vec3_t<T>(x, w, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> xwy()  const { return vec3_t<T>(x, w, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> xwz()  const { return vec3_t<T>(x, w, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> xww()  const { return vec3_t<T>(x, w, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> yxx()  const { return vec3_t<T>(y, x, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> yxy()  const { return vec3_t<T>(y, x, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> yxz()  const { return vec3_t<T>(y, x, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> yxw()  const { return vec3_t<T>(y, x, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> yyx()  const { return vec3_t<T>(y, y, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> yyy()  const { return vec3_t<T>(y, y, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> yyz()  const { return vec3_t<T>(y, y, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> yyw()  const { return vec3_t<T>(y, y, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> yzx()  const { return vec3_t<T>(y, z, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> yzy()  const { return vec3_t<T>(y, z, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> yzz()  const { return vec3_t<T>(y, z, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> yzw()  const { return vec3_t<T>(y, z, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> ywx()  const { return vec3_t<T>(y, w, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> ywy()  const { return vec3_t<T>(y, w, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> ywz()  const { return vec3_t<T>(y, w, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> yww()  const { return vec3_t<T>(y, w, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> zxx()  const { return vec3_t<T>(z, x, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> zxy()  const { return vec3_t<T>(z, x, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> zxz()  const { return vec3_t<T>(z, x, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> zxw()  const { return vec3_t<T>(z, x, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> zyx()  const { return vec3_t<T>(z, y, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> zyy()  const { return vec3_t<T>(z, y, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> zyz()  const { return vec3_t<T>(z, y, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> zyw()  const { return vec3_t<T>(z, y, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> zzx()  const { return vec3_t<T>(z, z, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> zzy()  const { return vec3_t<T>(z, z, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> zzz()  const { return vec3_t<T>(z, z, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> zzw()  const { return vec3_t<T>(z, z, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> zwx()  const { return vec3_t<T>(z, w, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> zwy()  const { return vec3_t<T>(z, w, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> zwz()  const { return vec3_t<T>(z, w, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> zww()  const { return vec3_t<T>(z, w, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> wxx()  const { return vec3_t<T>(w, x, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> wxy()  const { return vec3_t<T>(w, x, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> wxz()  const { return vec3_t<T>(w, x, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> wxw()  const { return vec3_t<T>(w, x, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> wyx()  const { return vec3_t<T>(w, y, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> wyy()  const { return vec3_t<T>(w, y, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> wyz()  const { return vec3_t<T>(w, y, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> wyw()  const { return vec3_t<T>(w, y, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> wzx()  const { return vec3_t<T>(w, z, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> wzy()  const { return vec3_t<T>(w, z, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> wzz()  const { return vec3_t<T>(w, z, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> wzw()  const { return vec3_t<T>(w, z, w);    }
+    ZMATH_CONSTEXPR vec3_t<T> wwx()  const { return vec3_t<T>(w, w, x);    }
+    ZMATH_CONSTEXPR vec3_t<T> wwy()  const { return vec3_t<T>(w, w, y);    }
+    ZMATH_CONSTEXPR vec3_t<T> wwz()  const { return vec3_t<T>(w, w, z);    }
+    ZMATH_CONSTEXPR vec3_t<T> www()  const { return vec3_t<T>(w, w, w);    }
+    ZMATH_CONSTEXPR vec4_t<T> xxxx() const { return vec4_t<T>(x, x, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xxxy() const { return vec4_t<T>(x, x, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xxxz() const { return vec4_t<T>(x, x, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xxxw() const { return vec4_t<T>(x, x, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xxyx() const { return vec4_t<T>(x, x, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xxyy() const { return vec4_t<T>(x, x, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xxyz() const { return vec4_t<T>(x, x, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xxyw() const { return vec4_t<T>(x, x, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xxzx() const { return vec4_t<T>(x, x, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xxzy() const { return vec4_t<T>(x, x, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xxzz() const { return vec4_t<T>(x, x, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xxzw() const { return vec4_t<T>(x, x, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xxwx() const { return vec4_t<T>(x, x, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xxwy() const { return vec4_t<T>(x, x, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xxwz() const { return vec4_t<T>(x, x, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xxww() const { return vec4_t<T>(x, x, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xyxx() const { return vec4_t<T>(x, y, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xyxy() const { return vec4_t<T>(x, y, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xyxz() const { return vec4_t<T>(x, y, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xyxw() const { return vec4_t<T>(x, y, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xyyx() const { return vec4_t<T>(x, y, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xyyy() const { return vec4_t<T>(x, y, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xyyz() const { return vec4_t<T>(x, y, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xyyw() const { return vec4_t<T>(x, y, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xyzx() const { return vec4_t<T>(x, y, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xyzy() const { return vec4_t<T>(x, y, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xyzz() const { return vec4_t<T>(x, y, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xyzw() const { return vec4_t<T>(x, y, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xywx() const { return vec4_t<T>(x, y, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xywy() const { return vec4_t<T>(x, y, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xywz() const { return vec4_t<T>(x, y, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xyww() const { return vec4_t<T>(x, y, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xzxx() const { return vec4_t<T>(x, z, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xzxy() const { return vec4_t<T>(x, z, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xzxz() const { return vec4_t<T>(x, z, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xzxw() const { return vec4_t<T>(x, z, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xzyx() const { return vec4_t<T>(x, z, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xzyy() const { return vec4_t<T>(x, z, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xzyz() const { return vec4_t<T>(x, z, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xzyw() const { return vec4_t<T>(x, z, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xzzx() const { return vec4_t<T>(x, z, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xzzy() const { return vec4_t<T>(x, z, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xzzz() const { return vec4_t<T>(x, z, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xzzw() const { return vec4_t<T>(x, z, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xzwx() const { return vec4_t<T>(x, z, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xzwy() const { return vec4_t<T>(x, z, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xzwz() const { return vec4_t<T>(x, z, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xzww() const { return vec4_t<T>(x, z, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xwxx() const { return vec4_t<T>(x, w, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xwxy() const { return vec4_t<T>(x, w, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xwxz() const { return vec4_t<T>(x, w, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xwxw() const { return vec4_t<T>(x, w, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xwyx() const { return vec4_t<T>(x, w, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xwyy() const { return vec4_t<T>(x, w, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xwyz() const { return vec4_t<T>(x, w, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xwyw() const { return vec4_t<T>(x, w, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xwzx() const { return vec4_t<T>(x, w, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xwzy() const { return vec4_t<T>(x, w, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xwzz() const { return vec4_t<T>(x, w, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xwzw() const { return vec4_t<T>(x, w, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> xwwx() const { return vec4_t<T>(x, w, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> xwwy() const { return vec4_t<T>(x, w, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> xwwz() const { return vec4_t<T>(x, w, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> xwww() const { return vec4_t<T>(x, w, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yxxx() const { return vec4_t<T>(y, x, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yxxy() const { return vec4_t<T>(y, x, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yxxz() const { return vec4_t<T>(y, x, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yxxw() const { return vec4_t<T>(y, x, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yxyx() const { return vec4_t<T>(y, x, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yxyy() const { return vec4_t<T>(y, x, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yxyz() const { return vec4_t<T>(y, x, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yxyw() const { return vec4_t<T>(y, x, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yxzx() const { return vec4_t<T>(y, x, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yxzy() const { return vec4_t<T>(y, x, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yxzz() const { return vec4_t<T>(y, x, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yxzw() const { return vec4_t<T>(y, x, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yxwx() const { return vec4_t<T>(y, x, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yxwy() const { return vec4_t<T>(y, x, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yxwz() const { return vec4_t<T>(y, x, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yxww() const { return vec4_t<T>(y, x, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yyxx() const { return vec4_t<T>(y, y, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yyxy() const { return vec4_t<T>(y, y, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yyxz() const { return vec4_t<T>(y, y, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yyxw() const { return vec4_t<T>(y, y, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yyyx() const { return vec4_t<T>(y, y, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yyyy() const { return vec4_t<T>(y, y, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yyyz() const { return vec4_t<T>(y, y, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yyyw() const { return vec4_t<T>(y, y, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yyzx() const { return vec4_t<T>(y, y, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yyzy() const { return vec4_t<T>(y, y, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yyzz() const { return vec4_t<T>(y, y, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yyzw() const { return vec4_t<T>(y, y, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yywx() const { return vec4_t<T>(y, y, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yywy() const { return vec4_t<T>(y, y, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yywz() const { return vec4_t<T>(y, y, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yyww() const { return vec4_t<T>(y, y, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yzxx() const { return vec4_t<T>(y, z, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yzxy() const { return vec4_t<T>(y, z, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yzxz() const { return vec4_t<T>(y, z, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yzxw() const { return vec4_t<T>(y, z, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yzyx() const { return vec4_t<T>(y, z, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yzyy() const { return vec4_t<T>(y, z, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yzyz() const { return vec4_t<T>(y, z, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yzyw() const { return vec4_t<T>(y, z, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yzzx() const { return vec4_t<T>(y, z, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yzzy() const { return vec4_t<T>(y, z, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yzzz() const { return vec4_t<T>(y, z, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yzzw() const { return vec4_t<T>(y, z, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> yzwx() const { return vec4_t<T>(y, z, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> yzwy() const { return vec4_t<T>(y, z, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> yzwz() const { return vec4_t<T>(y, z, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> yzww() const { return vec4_t<T>(y, z, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> ywxx() const { return vec4_t<T>(y, w, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> ywxy() const { return vec4_t<T>(y, w, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> ywxz() const { return vec4_t<T>(y, w, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> ywxw() const { return vec4_t<T>(y, w, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> ywyx() const { return vec4_t<T>(y, w, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> ywyy() const { return vec4_t<T>(y, w, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> ywyz() const { return vec4_t<T>(y, w, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> ywyw() const { return vec4_t<T>(y, w, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> ywzx() const { return vec4_t<T>(y, w, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> ywzy() const { return vec4_t<T>(y, w, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> ywzz() const { return vec4_t<T>(y, w, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> ywzw() const { return vec4_t<T>(y, w, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> ywwx() const { return vec4_t<T>(y, w, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> ywwy() const { return vec4_t<T>(y, w, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> ywwz() const { return vec4_t<T>(y, w, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> ywww() const { return vec4_t<T>(y, w, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zxxx() const { return vec4_t<T>(z, x, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zxxy() const { return vec4_t<T>(z, x, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zxxz() const { return vec4_t<T>(z, x, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zxxw() const { return vec4_t<T>(z, x, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zxyx() const { return vec4_t<T>(z, x, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zxyy() const { return vec4_t<T>(z, x, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zxyz() const { return vec4_t<T>(z, x, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zxyw() const { return vec4_t<T>(z, x, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zxzx() const { return vec4_t<T>(z, x, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zxzy() const { return vec4_t<T>(z, x, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zxzz() const { return vec4_t<T>(z, x, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zxzw() const { return vec4_t<T>(z, x, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zxwx() const { return vec4_t<T>(z, x, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zxwy() const { return vec4_t<T>(z, x, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zxwz() const { return vec4_t<T>(z, x, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zxww() const { return vec4_t<T>(z, x, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zyxx() const { return vec4_t<T>(z, y, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zyxy() const { return vec4_t<T>(z, y, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zyxz() const { return vec4_t<T>(z, y, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zyxw() const { return vec4_t<T>(z, y, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zyyx() const { return vec4_t<T>(z, y, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zyyy() const { return vec4_t<T>(z, y, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zyyz() const { return vec4_t<T>(z, y, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zyyw() const { return vec4_t<T>(z, y, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zyzx() const { return vec4_t<T>(z, y, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zyzy() const { return vec4_t<T>(z, y, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zyzz() const { return vec4_t<T>(z, y, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zyzw() const { return vec4_t<T>(z, y, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zywx() const { return vec4_t<T>(z, y, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zywy() const { return vec4_t<T>(z, y, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zywz() const { return vec4_t<T>(z, y, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zyww() const { return vec4_t<T>(z, y, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zzxx() const { return vec4_t<T>(z, z, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zzxy() const { return vec4_t<T>(z, z, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zzxz() const { return vec4_t<T>(z, z, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zzxw() const { return vec4_t<T>(z, z, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zzyx() const { return vec4_t<T>(z, z, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zzyy() const { return vec4_t<T>(z, z, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zzyz() const { return vec4_t<T>(z, z, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zzyw() const { return vec4_t<T>(z, z, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zzzx() const { return vec4_t<T>(z, z, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zzzy() const { return vec4_t<T>(z, z, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zzzz() const { return vec4_t<T>(z, z, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zzzw() const { return vec4_t<T>(z, z, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zzwx() const { return vec4_t<T>(z, z, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zzwy() const { return vec4_t<T>(z, z, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zzwz() const { return vec4_t<T>(z, z, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zzww() const { return vec4_t<T>(z, z, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zwxx() const { return vec4_t<T>(z, w, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zwxy() const { return vec4_t<T>(z, w, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zwxz() const { return vec4_t<T>(z, w, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zwxw() const { return vec4_t<T>(z, w, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zwyx() const { return vec4_t<T>(z, w, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zwyy() const { return vec4_t<T>(z, w, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zwyz() const { return vec4_t<T>(z, w, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zwyw() const { return vec4_t<T>(z, w, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zwzx() const { return vec4_t<T>(z, w, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zwzy() const { return vec4_t<T>(z, w, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zwzz() const { return vec4_t<T>(z, w, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zwzw() const { return vec4_t<T>(z, w, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> zwwx() const { return vec4_t<T>(z, w, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> zwwy() const { return vec4_t<T>(z, w, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> zwwz() const { return vec4_t<T>(z, w, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> zwww() const { return vec4_t<T>(z, w, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wxxx() const { return vec4_t<T>(w, x, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wxxy() const { return vec4_t<T>(w, x, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wxxz() const { return vec4_t<T>(w, x, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wxxw() const { return vec4_t<T>(w, x, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wxyx() const { return vec4_t<T>(w, x, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wxyy() const { return vec4_t<T>(w, x, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wxyz() const { return vec4_t<T>(w, x, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wxyw() const { return vec4_t<T>(w, x, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wxzx() const { return vec4_t<T>(w, x, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wxzy() const { return vec4_t<T>(w, x, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wxzz() const { return vec4_t<T>(w, x, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wxzw() const { return vec4_t<T>(w, x, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wxwx() const { return vec4_t<T>(w, x, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wxwy() const { return vec4_t<T>(w, x, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wxwz() const { return vec4_t<T>(w, x, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wxww() const { return vec4_t<T>(w, x, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wyxx() const { return vec4_t<T>(w, y, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wyxy() const { return vec4_t<T>(w, y, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wyxz() const { return vec4_t<T>(w, y, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wyxw() const { return vec4_t<T>(w, y, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wyyx() const { return vec4_t<T>(w, y, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wyyy() const { return vec4_t<T>(w, y, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wyyz() const { return vec4_t<T>(w, y, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wyyw() const { return vec4_t<T>(w, y, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wyzx() const { return vec4_t<T>(w, y, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wyzy() const { return vec4_t<T>(w, y, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wyzz() const { return vec4_t<T>(w, y, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wyzw() const { return vec4_t<T>(w, y, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wywx() const { return vec4_t<T>(w, y, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wywy() const { return vec4_t<T>(w, y, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wywz() const { return vec4_t<T>(w, y, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wyww() const { return vec4_t<T>(w, y, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wzxx() const { return vec4_t<T>(w, z, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wzxy() const { return vec4_t<T>(w, z, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wzxz() const { return vec4_t<T>(w, z, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wzxw() const { return vec4_t<T>(w, z, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wzyx() const { return vec4_t<T>(w, z, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wzyy() const { return vec4_t<T>(w, z, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wzyz() const { return vec4_t<T>(w, z, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wzyw() const { return vec4_t<T>(w, z, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wzzx() const { return vec4_t<T>(w, z, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wzzy() const { return vec4_t<T>(w, z, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wzzz() const { return vec4_t<T>(w, z, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wzzw() const { return vec4_t<T>(w, z, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wzwx() const { return vec4_t<T>(w, z, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wzwy() const { return vec4_t<T>(w, z, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wzwz() const { return vec4_t<T>(w, z, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wzww() const { return vec4_t<T>(w, z, w, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wwxx() const { return vec4_t<T>(w, w, x, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wwxy() const { return vec4_t<T>(w, w, x, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wwxz() const { return vec4_t<T>(w, w, x, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wwxw() const { return vec4_t<T>(w, w, x, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wwyx() const { return vec4_t<T>(w, w, y, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wwyy() const { return vec4_t<T>(w, w, y, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wwyz() const { return vec4_t<T>(w, w, y, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wwyw() const { return vec4_t<T>(w, w, y, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wwzx() const { return vec4_t<T>(w, w, z, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wwzy() const { return vec4_t<T>(w, w, z, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wwzz() const { return vec4_t<T>(w, w, z, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wwzw() const { return vec4_t<T>(w, w, z, w); }
+    ZMATH_CONSTEXPR vec4_t<T> wwwx() const { return vec4_t<T>(w, w, w, x); }
+    ZMATH_CONSTEXPR vec4_t<T> wwwy() const { return vec4_t<T>(w, w, w, y); }
+    ZMATH_CONSTEXPR vec4_t<T> wwwz() const { return vec4_t<T>(w, w, w, z); }
+    ZMATH_CONSTEXPR vec4_t<T> wwww() const { return vec4_t<T>(w, w, w, w); }
 };
 
 template<class T>
-T dot(const vec4_t<T>& v1, const vec4_t<T>& v2) {
+ZMATH_CONSTEXPR T dot(const vec4_t<T>& v1, const vec4_t<T>& v2) {
     return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z + v1.w * v2.w;
 }
 
@@ -529,8 +531,23 @@ vec4_t<T> normalize(const vec4_t<T>& v) {
     return vec4_t<T>(v.x * m, v.y * m, v.z * m, v.w * m);
 }
 
+// normalize with the estimate of rsqrt_fast
 template<class T>
-vec4_t<T> minimize(const vec4_t<T>& v1, const vec4_t<T>& v2) {
+vec4_t<T> normalize_fast(const vec4_t<T>& v) {
+    auto d = dot(v, v);
+    auto m = (d > sqr(std::numeric_limits<T>::epsilon())) ? rsqrt_fast(d) : T(0);
+    return vec4_t<T>(v.x * m, v.y * m, v.z * m, v.w * m);
+}
+
+template<class T>
+void normalize_fast(vec4_t<T>* out, const vec4_t<T>* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = normalize_fast(in[i]);
+    }
+}
+
+template<class T>
+ZMATH_CONSTEXPR vec4_t<T> minimize(const vec4_t<T>& v1, const vec4_t<T>& v2) {
     return vec4_t<T>((v1.x < v2.x) ? v1.x : v2.x,
                      (v1.y < v2.y) ? v1.y : v2.y,
                      (v1.z < v2.z) ? v1.z : v2.z,
@@ -538,7 +555,7 @@ vec4_t<T> minimize(const vec4_t<T>& v1, const vec4_t<T>& v2) {
 }
 
 template<class T>
-vec4_t<T> maximize(const vec4_t<T>& v1, const vec4_t<T>& v2) {
+ZMATH_CONSTEXPR vec4_t<T> maximize(const vec4_t<T>& v1, const vec4_t<T>& v2) {
     return vec4_t<T>((v1.x > v2.x) ? v1.x : v2.x,
                      (v1.y > v2.y) ? v1.y : v2.y,
                      (v1.z > v2.z) ? v1.z : v2.z,
@@ -551,12 +568,12 @@ T length(const vec4_t<T>& v) {
 }
 
 template<class T>
-T length2(const vec4_t<T>& v) {
+ZMATH_CONSTEXPR T length2(const vec4_t<T>& v) {
     return v.x*v.x + v.y*v.y + v.z*v.z + v.w*v.w;
 }
 
 template<class T>
-vec4_t<T> abs(const vec4_t<T>& v) {
+ZMATH_CONSTEXPR vec4_t<T> abs(const vec4_t<T>& v) {
     return vec4_t<T>((v.x < 0) ? -v.x : v.x,
                      (v.y < 0) ? -v.y : v.y,
                      (v.z < 0) ? -v.z : v.z,
@@ -564,7 +581,7 @@ vec4_t<T> abs(const vec4_t<T>& v) {
 }
 
 template<class T>
-vec4_t<T> clamp(const vec4_t<T>& v, T min, T max) {
+ZMATH_CONSTEXPR vec4_t<T> clamp(const vec4_t<T>& v, T min, T max) {
     return vec4_t<T>((v.x < min) ? min : ((v.x > max) ? max : v.x),
                      (v.y < min) ? min : ((v.y > max) ? max : v.y),
                      (v.z < min) ? min : ((v.z > max) ? max : v.z),
@@ -572,7 +589,7 @@ vec4_t<T> clamp(const vec4_t<T>& v, T min, T max) {
 }
 
 template<class T>
-vec4_t<T> clamp(const vec4_t<T>& v, const vec4_t<T>& min, const vec4_t<T>& max) {
+ZMATH_CONSTEXPR vec4_t<T> clamp(const vec4_t<T>& v, const vec4_t<T>& min, const vec4_t<T>& max) {
     return vec4_t<T>((v.x < min.x) ? min.x : ((v.x > max.x) ? max.x : v.x),
                      (v.y < min.y) ? min.y : ((v.y > max.y) ? max.y : v.y),
                      (v.z < min.z) ? min.z : ((v.z > max.z) ? max.z : v.z),
@@ -580,7 +597,7 @@ vec4_t<T> clamp(const vec4_t<T>& v, const vec4_t<T>& min, const vec4_t<T>& max)
 }
 
 template<class T>
-vec4_t<T> lerp(const vec4_t<T>& min, const vec4_t<T>& max, T scale) {
+ZMATH_CONSTEXPR vec4_t<T> lerp(const vec4_t<T>& min, const vec4_t<T>& max, T scale) {
     return vec4_t<T>(min.x + scale * (max.x - min.x),
                      min.y + scale * (max.y - min.y),
                      min.z + scale * (max.z - min.z),
@@ -588,9 +605,50 @@ vec4_t<T> lerp(const vec4_t<T>& min, const vec4_t<T>& max, T scale) {
 }
 
 template<class T>
-vec4_t<T> saturate(const vec4_t<T>& v) {
+ZMATH_CONSTEXPR vec4_t<T> saturate(const vec4_t<T>& v) {
     return vec4_t<T>((v.x < 0) ? 0 : ((v.x > 1) ? 1 : v.x),
                      (v.y < 0) ? 0 : ((v.y > 1) ? 1 : v.y),
                      (v.z < 0) ? 0 : ((v.z > 1) ? 1 : v.z),
                      (v.w < 0) ? 0 : ((v.w > 1) ? 1 : v.w));
 }
+
+#if defined(ZMATH_SIMD)
+template<>
+inline vec4_t<float> vec4_t<float>::operator * (const mat4x4_t<float>& m) const {
+    auto v = simd_mul(simd_splat(x), simd_load(m.m[0]));
+    v = simd_madd(simd_splat(y), simd_load(m.m[1]), v);
+    v = simd_madd(simd_splat(z), simd_load(m.m[2]), v);
+    v = simd_madd(simd_splat(w), simd_load(m.m[3]), v);
+    vec4_t<float> tmp;
+    simd_store(&tmp.x, v);
+    return tmp;
+}
+
+template<>
+inline vec4_t<float>& vec4_t<float>::operator *= (const mat4x4_t<float>& m) {
+    *this = *this * m;
+    return *this;
+}
+
+template<>
+inline void normalize_fast(vec4_t<float>* out, const vec4_t<float>* in, size_t count) {
+    auto blocks = count / 4;
+
+    for (size_t i = 0; i < blocks; ++i) {
+        simd4f v[4], c[4];
+        for (int j = 0; j < 4; ++j) {
+            v[j] = c[j] = simd_load(&in[i * 4 + j].x);
+        }
+        simd_transpose(c[0], c[1], c[2], c[3]);
+        auto m = simd_normalize_scale(simd_madd(c[0], c[0], simd_madd(c[1], c[1], simd_madd(c[2], c[2], simd_mul(c[3], c[3])))));
+        simd_store(&out[i * 4].x,     simd_mul(v[0], simd_shuffle<0, 0, 0, 0>(m, m)));
+        simd_store(&out[i * 4 + 1].x, simd_mul(v[1], simd_shuffle<1, 1, 1, 1>(m, m)));
+        simd_store(&out[i * 4 + 2].x, simd_mul(v[2], simd_shuffle<2, 2, 2, 2>(m, m)));
+        simd_store(&out[i * 4 + 3].x, simd_mul(v[3], simd_shuffle<3, 3, 3, 3>(m, m)));
+    }
+
+    for (auto i = blocks * 4; i < count; ++i) {
+        out[i] = normalize_fast(in[i]);
+    }
+}
+#endif
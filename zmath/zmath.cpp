@@ -21,15 +21,50 @@
 //
 #include "zmath.h"
 
+template struct aabb_t<float>;
+template struct aabb_t<double>;
+template struct anim_clip_t<float>;
+template struct bvh_t<float>;
 template struct color3_t<float>;
 template struct color4_t<float>;
+template struct dualquat_t<float>;
+template struct dualquat_t<double>;
+template struct frustum_t<float>;
+template struct frustum_t<double>;
+template struct hierarchy_t<float>;
+template struct hierarchy_t<double>;
 template struct mat2x2_t<float>;
+template struct mat2x2_t<double>;
 template struct mat3x3_t<float>;
+template struct mat3x3_t<double>;
+template struct mat3x3_t<fixed32>;
+template struct mat3x3_t<fixed64>;
 template struct mat4x3_t<float>;
+template struct mat4x3_t<double>;
 template struct mat4x4_t<float>;
+template struct mat4x4_t<double>;
 template struct plane_t<float>;
+template struct plane_t<double>;
+template struct pose_sampler_t<float>;
 template struct quat_t<float>;
+template struct quat_t<double>;
+template struct quat_t<fixed32>;
+template struct quat_t<fixed64>;
+template struct quat_t<half>;
+template struct quat_track_t<float>;
 template struct ray_t<float>;
+template struct ray_t<double>;
 template struct vec2_t<float>;
+template struct vec2_t<double>;
+template struct vec2_t<fixed32>;
+template struct vec2_t<fixed64>;
+template struct vec2_t<half>;
 template struct vec3_t<float>;
+template struct vec3_t<double>;
+template struct vec3_t<fixed32>;
+template struct vec3_t<fixed64>;
+template struct vec3_t<half>;
+template struct vec3_track_t<float>;
 template struct vec4_t<float>;
+template struct vec4_t<double>;
+template struct vec4_t<half>;
@@ -23,45 +23,116 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <limits>
 
+// Constructors, factories and single-return operators are constexpr from
+// C++11 on; compound assignments and functions with local statements need the
+// relaxed rules of C++14 and are plain functions before that.
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define ZMATH_CONSTEXPR
+#else
+#define ZMATH_CONSTEXPR constexpr
+#endif
+
+#if (defined(__cpp_constexpr) && __cpp_constexpr >= 201304) || (defined(_MSC_VER) && _MSC_VER >= 1910)
+#define ZMATH_CONSTEXPR14 constexpr
+#else
+#define ZMATH_CONSTEXPR14
+#endif
+
 // Forward declarations
+template<class T> struct aabb_t;
+template<class T> struct anim_clip_t;
+template<class T> struct bvh_t;
 template<class T> struct color3_t;
 template<class T> struct color4_t;
+template<class T> struct dualquat_t;
+template<class T> struct frustum_t;
+template<class T> struct hierarchy_t;
 template<class T> struct mat2x2_t;
 template<class T> struct mat3x3_t;
 template<class T> struct mat4x3_t;
 template<class T> struct mat4x4_t;
 template<class T> struct plane_t;
+template<class T> struct pose_sampler_t;
 template<class T> struct quat_t;
+template<class T> struct quat_track_t;
 template<class T> struct ray_t;
 template<class T> struct vec2_t;
 template<class T> struct vec3_t;
+template<class T> struct vec3_track_t;
 template<class T> struct vec4_t;
 
 #include "color3.h"
 #include "color4.h"
 #include "shared.h"
+#include "simd.h"
 #include "mat2x2.h"
 #include "mat3x3.h"
 #include "mat4x3.h"
 #include "mat4x4.h"
-#include "plane.h"
 #include "quat.h"
-#include "ray.h"
 #include "vec2.h"
 #include "vec3.h"
 #include "vec4.h"
+#include "plane.h"
+#include "aabb.h"
+#include "ray.h"
+#include "bvh.h"
+#include "frustum.h"
+#include "skinning.h"
+#include "dualquat.h"
+#include "quatpack.h"
+#include "half.h"
+#include "fixed.h"
+#include "srgb.h"
+#include "colorpack.h"
+#include "track.h"
+#include "hierarchy.h"
+#include "soa.h"
+#include "transform.h"
+#include "camera.h"
+#include "euler.h"
 
+typedef aabb_t<float>   aabb;
+typedef aabb_t<double>  aabbd;
+typedef anim_clip_t<float> anim_clip;
+typedef bvh_t<float>    bvh;
 typedef color3_t<float> color3;
 typedef color4_t<float> color4;
+typedef dualquat_t<float> dualquat;
+typedef dualquat_t<double> dualquatd;
+typedef fixed_t<int32_t, 16> fixed32;
+typedef fixed_t<int64_t, 32> fixed64;
+typedef frustum_t<float> frustum;
+typedef frustum_t<double> frustumd;
+typedef hierarchy_t<float> hierarchy;
+typedef hierarchy_t<double> hierarchyd;
 typedef mat2x2_t<float> mat2x2;
+typedef mat2x2_t<double> mat2x2d;
 typedef mat3x3_t<float> mat3x3;
+typedef mat3x3_t<double> mat3x3d;
 typedef mat4x3_t<float> mat4x3;
+typedef mat4x3_t<double> mat4x3d;
 typedef mat4x4_t<float> mat4x4;
+typedef mat4x4_t<double> mat4x4d;
 typedef plane_t<float>  plane;
+typedef plane_t<double> planed;
+typedef pose_sampler_t<float> pose_sampler;
 typedef quat_t<float>   quat;
+typedef quat_t<double>  quatd;
+typedef quat_t<half>    quath;
+typedef quat_track_t<float> quat_track;
 typedef ray_t<float>    ray;
+typedef ray_t<double>   rayd;
 typedef vec2_t<float>   vec2;
+typedef vec2_t<double>  vec2d;
+typedef vec2_t<half>    vec2h;
 typedef vec3_t<float>   vec3;
+typedef vec3_t<double>  vec3d;
+typedef vec3_t<half>    vec3h;
+typedef vec3_track_t<float> vec3_track;
 typedef vec4_t<float>   vec4;
+typedef vec4_t<double>  vec4d;
+typedef vec4_t<half>    vec4h;